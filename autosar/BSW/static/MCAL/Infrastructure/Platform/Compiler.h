@@ -38,7 +38,7 @@ multiple inclusions. */
 /**********************************************************************************/
 
 /* Inclusion of compiler configurations header file */
-#include <Compiler_cfg.h>
+#include <Compiler_Cfg.h>
 
 
 
@@ -25,18 +25,26 @@ PriorityLevel1Queue
 TaskFlagsType Task0Flags =
 {
 	.Type = BASIC,
-	.TaskSchedulingPolicy = FULL_PREEMPTIVE_SCHEDULING
+	.TaskSchedulingPolicy = FULL_PREEMPTIVE_SCHEDULING,
+	.Trusted = FALSE,
+	.InterruptLock = TRUE
 };
 TaskFlagsType Task1Flags =
 {
 	.Type = BASIC,
-	.TaskSchedulingPolicy = FULL_PREEMPTIVE_SCHEDULING
+	.TaskSchedulingPolicy = FULL_PREEMPTIVE_SCHEDULING,
+	.Trusted = FALSE,
+	.InterruptLock = TRUE
 };
+#if (OS_CONTEXTLESS_IDLE == STD_OFF)
 TaskFlagsType IdleTaskFlags =
 {
 	.Type = BASIC,
-	.TaskSchedulingPolicy = FULL_PREEMPTIVE_SCHEDULING
+	.TaskSchedulingPolicy = FULL_PREEMPTIVE_SCHEDULING,
+	.Trusted = FALSE,
+	.InterruptLock = FALSE
 };
+#endif /* #if (OS_CONTEXTLESS_IDLE == STD_OFF) */
 
 
 
@@ -49,14 +57,65 @@ TaskStackType Task0Stack =
 };
 TaskStackType Task1Stack =
 {
-	.StackBase = (StackPtrType)0x20004500,
+	.StackBase = (StackPtrType)0x20004600,
 	.StackSize = 0x200,
 };
+#if (OS_CONTEXTLESS_IDLE == STD_OFF)
 TaskStackType IdleTaskStack =
 {
 	.StackBase = (StackPtrType)0x20005000,
 	.StackSize = 0x200,
 };
+#endif /* #if (OS_CONTEXTLESS_IDLE == STD_OFF) */
+
+
+
+#if (OS_MPU_PROTECTION == STD_ON)
+/* Regions 0..3: Code region read-only for the tasks, the counter time snapshots
+   (.os_counter_time, 128 bytes at 0x20008000) read-only for the tasks, the rest of the
+   memory is privileged only */
+CONST(Os_MpuRegionType, OS_CONST) OsMpuStaticRegions[OS_MPU_STATIC_REGIONS] =
+{
+	{ OS_MPU_RBAR(0x00000000, 0), OS_MPU_RASR(29, OS_MPU_AP_RO, OS_MPU_EXEC, OS_MPU_ATTR_FLASH) },
+	{ OS_MPU_RBAR(0x20008000, 1), OS_MPU_RASR(7, OS_MPU_AP_USER_RO, OS_MPU_XN, OS_MPU_ATTR_SRAM) },
+	OS_MPU_REGION_DISABLED(2),
+	OS_MPU_REGION_DISABLED(3)
+};
+
+/* Regions 4..7 of the tasks: stack, private data, shared data, spare */
+CONST(TaskMpuType, OS_CONST) Task0Mpu =
+{
+	.Regions =
+	{
+		{ OS_MPU_RBAR(0x20003E00, OS_MPU_TASK_REGION(0)), OS_MPU_RASR(9, OS_MPU_AP_FULL, OS_MPU_XN, OS_MPU_ATTR_SRAM) },
+		{ OS_MPU_RBAR(0x20006000, OS_MPU_TASK_REGION(1)), OS_MPU_RASR(10, OS_MPU_AP_FULL, OS_MPU_XN, OS_MPU_ATTR_SRAM) },
+		{ OS_MPU_RBAR(0x20007000, OS_MPU_TASK_REGION(2)), OS_MPU_RASR(12, OS_MPU_AP_FULL, OS_MPU_XN, OS_MPU_ATTR_SRAM) },
+		OS_MPU_REGION_DISABLED(OS_MPU_TASK_REGION(3))
+	}
+};
+CONST(TaskMpuType, OS_CONST) Task1Mpu =
+{
+	.Regions =
+	{
+		{ OS_MPU_RBAR(0x20004400, OS_MPU_TASK_REGION(0)), OS_MPU_RASR(9, OS_MPU_AP_FULL, OS_MPU_XN, OS_MPU_ATTR_SRAM) },
+		{ OS_MPU_RBAR(0x20006400, OS_MPU_TASK_REGION(1)), OS_MPU_RASR(10, OS_MPU_AP_FULL, OS_MPU_XN, OS_MPU_ATTR_SRAM) },
+		{ OS_MPU_RBAR(0x20007000, OS_MPU_TASK_REGION(2)), OS_MPU_RASR(12, OS_MPU_AP_FULL, OS_MPU_XN, OS_MPU_ATTR_SRAM) },
+		OS_MPU_REGION_DISABLED(OS_MPU_TASK_REGION(3))
+	}
+};
+#if (OS_CONTEXTLESS_IDLE == STD_OFF)
+CONST(TaskMpuType, OS_CONST) IdleTaskMpu =
+{
+	.Regions =
+	{
+		{ OS_MPU_RBAR(0x20004E00, OS_MPU_TASK_REGION(0)), OS_MPU_RASR(9, OS_MPU_AP_FULL, OS_MPU_XN, OS_MPU_ATTR_SRAM) },
+		OS_MPU_REGION_DISABLED(OS_MPU_TASK_REGION(1)),
+		OS_MPU_REGION_DISABLED(OS_MPU_TASK_REGION(2)),
+		OS_MPU_REGION_DISABLED(OS_MPU_TASK_REGION(3))
+	}
+};
+#endif /* #if (OS_CONTEXTLESS_IDLE == STD_OFF) */
+#endif /* #if (OS_MPU_PROTECTION == STD_ON) */
 
 
 
@@ -86,6 +145,7 @@ Os_TaskDynamic Task1Dynamic =
 	.TaskState = SUSPENDED,
 	.PendingActivationRequests = 0	
 };
+#if (OS_CONTEXTLESS_IDLE == STD_OFF)
 Os_TaskDynamic IdleTaskDynamic =
 {
 	.Context = NULL_PTR,
@@ -97,6 +157,7 @@ Os_TaskDynamic IdleTaskDynamic =
 	.TaskState = SUSPENDED,
 	.PendingActivationRequests = 0	
 };
+#endif /* #if (OS_CONTEXTLESS_IDLE == STD_OFF) */
 
 Os_Task Tasks[TASK_COUNT] =
 {
@@ -107,6 +168,9 @@ Os_Task Tasks[TASK_COUNT] =
 		.NumOfActivationRequests = 1,
 		.TaskFlags = &Task0Flags,
 		.TaskStack = &Task0Stack,
+#if (OS_MPU_PROTECTION == STD_ON)
+		.TaskMpu = &Task0Mpu,
+#endif /* #if (OS_MPU_PROTECTION == STD_ON) */
 		.EntryPoint = OSEK_TASK_Task0,
 		.InternalResource = NULL_PTR,
 		.EventsOwned = 0,
@@ -119,11 +183,15 @@ Os_Task Tasks[TASK_COUNT] =
 		.NumOfActivationRequests = 1,
 		.TaskFlags = &Task1Flags,
 		.TaskStack = &Task1Stack,
+#if (OS_MPU_PROTECTION == STD_ON)
+		.TaskMpu = &Task1Mpu,
+#endif /* #if (OS_MPU_PROTECTION == STD_ON) */
 		.EntryPoint = OSEK_TASK_Task1,
 		.InternalResource = NULL_PTR,
 		.EventsOwned = 0,
 		.TaskDynamics = &Task1Dynamic
 	},
+#if (OS_CONTEXTLESS_IDLE == STD_OFF)
 	{
 		.TaskStaticPriority = 0,
 		.TaskID = IdleTaskId,
@@ -131,11 +199,15 @@ Os_Task Tasks[TASK_COUNT] =
 		.NumOfActivationRequests = 1,
 		.TaskFlags = &IdleTaskFlags,
 		.TaskStack = &IdleTaskStack,
+#if (OS_MPU_PROTECTION == STD_ON)
+		.TaskMpu = &IdleTaskMpu,
+#endif /* #if (OS_MPU_PROTECTION == STD_ON) */
 		.EntryPoint = OS_CoretexIdle,
 		.InternalResource = NULL_PTR,
 		.EventsOwned = 0,
 		.TaskDynamics = &IdleTaskDynamic
 	}
+#endif /* #if (OS_CONTEXTLESS_IDLE == STD_OFF) */
 };
 
 TaskType AutoStartTasks [1] = {
@@ -156,7 +228,10 @@ Os_Kernel Kernel =
 	.ForceScheduling = FALSE,
 	.SchedulerNeeded = FALSE,
 	.DispatcherNeeded = FALSE,
-	.NewContext = FALSE
+	.NewContext = FALSE,
+	.IsrNestingLevel = 0U,
+	.IsrPreviousState = OS_STATE_BOOT,
+	.IdleWaiting = FALSE
 };
 
 Os_AppMode ApplicationModes[MAX_NO_APPMODES] =
@@ -169,6 +244,27 @@ Os_AppMode ApplicationModes[MAX_NO_APPMODES] =
 	}
 };
 
+/* Tick ISR of Counter1, IRQ 4 on the target */
+OS_COUNTER_ISR(Timer_Ch0Isr, Counter1)
+
+/* Tick source of Counter1: timer channel 0, one tick every 10 ms */
+static CONST(Os_CounterDriver, OS_CONST) Counter1_Driver =
+{
+#if (OS_ARCH == OS_POSIX)
+	.OsCounterDriverStart = Os_PosixTimerStart,
+#else
+	/* Started by the board */
+	.OsCounterDriverStart = NULL_PTR,
+#endif /* #if (OS_ARCH == OS_POSIX) */
+	.OsCounterDriverAck = NULL_PTR,
+	.OsCounterDriverIsr = Timer_Ch0Isr,
+	.OsCounterDriverChannel = 0,
+	.OsCounterDriverPeriod = 10000
+};
+
+/* Time snapshots of the counters, read by the tasks */
+Os_CounterTime CounterTimes[COUNTER_COUNT] OS_COUNTER_TIME_SECTION;
+
 Os_Counter Counters [COUNTER_COUNT]=
 {
 	{
@@ -183,7 +279,47 @@ Os_Counter Counters [COUNTER_COUNT]=
 		/* The number of ticks of the counter that make up one OsTick. */
 		.OsCounterTicksPerBase = 1,
 		/* The index of head counter*/
-		.OsCounterAlarmsHeadIndex  = 0
+		.OsCounterAlarmsHeadIndex  = 0,
+		/* Driven by SysTick */
+		.OsCounterDriver = NULL_PTR,
+		/* Time snapshot */
+		.OsCounterTime = &CounterTimes[0]
+	},
+	{
+		/* Maximum possible allowed value of the system counter in ticks. */
+		.OsCounterMaxAllowedValue = 0xEA60,
+		/* The MINCYCLE attribute specifies the minimum allowed number of counter ticks for a cyclic alarm linked to the counter. */
+		.OsCounterMinCycle = 0x01,
+		/* The number of seconds in one OsTick. */
+		.OsSecondsPerTick = 0x01,
+		/* The type of the counter. */
+		.OsCounterType = COUNTER_HARDWARE,
+		/* The number of ticks of the counter that make up one OsTick. */
+		.OsCounterTicksPerBase = 1,
+		/* The index of head counter*/
+		.OsCounterAlarmsHeadIndex  = 1,
+		/* Driven by timer channel 0 */
+		.OsCounterDriver = &Counter1_Driver,
+		/* Time snapshot */
+		.OsCounterTime = &CounterTimes[1]
+	},
+	{
+		/* Maximum possible allowed value of the system counter in ticks. */
+		.OsCounterMaxAllowedValue = 0xEA60,
+		/* The MINCYCLE attribute specifies the minimum allowed number of counter ticks for a cyclic alarm linked to the counter. */
+		.OsCounterMinCycle = 0x01,
+		/* The number of seconds in one OsTick. */
+		.OsSecondsPerTick = 0x01,
+		/* The type of the counter. */
+		.OsCounterType = COUNTER_SOFTWARE,
+		/* The number of ticks of the counter that make up one OsTick. */
+		.OsCounterTicksPerBase = 1,
+		/* The index of head counter*/
+		.OsCounterAlarmsHeadIndex  = 2,
+		/* Incremented by Alarm2 */
+		.OsCounterDriver = NULL_PTR,
+		/* Time snapshot */
+		.OsCounterTime = &CounterTimes[2]
 	}
 };
 
@@ -194,6 +330,25 @@ Os_AlarmActivateTask Task1_Alarm0 =
 
 
 
+/* Cascade levels of the counters: 0 for a hardware counter, above the level of the
+   counter of the alarms incrementing a software counter */
+#define OS_COUNTER_LEVEL_Counter0		(0U)
+#define OS_COUNTER_LEVEL_Counter1		(0U)
+#define OS_COUNTER_LEVEL_Counter2		(1U)
+
+#if (OS_COUNTER_LEVEL_Counter2 <= OS_COUNTER_LEVEL_Counter0)
+#error Alarm2 shall increment a software counter of a higher level than Counter0, the increments form a cycle
+#endif
+
+#if (OS_COUNTER_LEVEL_Counter2 > OS_COUNTER_CASCADE_DEPTH)
+#error Alarm2 cascades the counters deeper than OS_COUNTER_CASCADE_DEPTH
+#endif
+
+Os_AlarmIncrementCounter Counter2_Alarm2 =
+{
+	.OsAlarmIncrementCounterRef = Counter2
+};
+
 Os_Alarm Alarms[ALARM_COUNT] = 
 {
 	{
@@ -206,10 +361,99 @@ Os_Alarm Alarms[ALARM_COUNT] =
 		.OsAlarmAlarmTime = 5,
 		.OsAlarmAutoStartType = ALARM_RELATIVE,
 		.OsAlarmCycleTime = 5
+	},
+	{
+		/* Task1 every 100 ms on the 10 ms counter, not started */
+		.OsAlarmAction =
+		{
+			.OsAlarmActivateTask = &Task1_Alarm0,
+		},
+		.OsAlarmCounterRef = &Counters[1],
+		.OsAlarmActionType = ALARM_ACTIVATE_TASK,
+		.OsAlarmAlarmTime = 10,
+		.OsAlarmAutoStartType = ALARM_RELATIVE,
+		.OsAlarmCycleTime = 10
+	},
+	{
+		/* Counter2 every 100 ms on the 1 ms counter, not started */
+		.OsAlarmAction =
+		{
+			.OsAlarmIncrementCounter = &Counter2_Alarm2,
+		},
+		.OsAlarmCounterRef = &Counters[0],
+		.OsAlarmActionType = ALARM_INCREMENT_COUNTER,
+		.OsAlarmAlarmTime = 100,
+		.OsAlarmAutoStartType = ALARM_RELATIVE,
+		.OsAlarmCycleTime = 100
 	}
 };
 
 Os_Alarm* ActiveAlarmsHead[COUNTER_COUNT] =
 {
+	NULL_PTR,
+	NULL_PTR,
 	NULL_PTR
-};
\ No newline at end of file
+};
+
+#if (SCHEDULE_TABLE_COUNT > 0)
+/* SchedTbl0: Task1 at the offsets 0 and 10 of a repeating round of 20 ticks, not started.
+   Explicitly synchronised, each point corrects up to 2 ticks of deviation */
+static CONST(TaskType, OS_CONST) SchedTbl0_Tasks[1] =
+{
+	Task1_ID
+};
+
+static CONST(Os_ExpiryPoint, OS_CONST) SchedTbl0_ExpiryPoints[2] =
+{
+	{
+		.OsExpiryPointOffset = 0,
+		.OsExpiryPointTasks = SchedTbl0_Tasks,
+		.OsExpiryPointTaskCount = 1,
+		.OsExpiryPointEvents = NULL_PTR,
+		.OsExpiryPointEventCount = 0,
+		.OsExpiryPointMaxShorten = 2,
+		.OsExpiryPointMaxLengthen = 2
+	},
+	{
+		.OsExpiryPointOffset = 10,
+		.OsExpiryPointTasks = SchedTbl0_Tasks,
+		.OsExpiryPointTaskCount = 1,
+		.OsExpiryPointEvents = NULL_PTR,
+		.OsExpiryPointEventCount = 0,
+		.OsExpiryPointMaxShorten = 2,
+		.OsExpiryPointMaxLengthen = 2
+	}
+};
+
+Os_ScheduleTable ScheduleTables[SCHEDULE_TABLE_COUNT] =
+{
+	{
+		.OsScheduleTableExpiryPoints = SchedTbl0_ExpiryPoints,
+		.OsScheduleTableExpiryPointCount = 2,
+		.OsScheduleTableDuration = 20,
+		.OsScheduleTableRepeating = TRUE,
+		.OsScheduleTableCounterRef = &Counters[0],
+		.OsScheduleTableSyncStrategy = SCHEDULETABLE_SYNC_EXPLICIT,
+		.OsScheduleTblExplicitPrecision = 1,
+		.OsScheduleTableState = SCHEDULETABLE_STOPPED
+	}
+};
+
+/* Running schedule tables of the counters, indexed by OsCounterAlarmsHeadIndex */
+Os_ScheduleTable* ScheduleTablesHead[COUNTER_COUNT] =
+{
+	NULL_PTR,
+	NULL_PTR,
+	NULL_PTR
+};
+#endif /* #if (SCHEDULE_TABLE_COUNT > 0) */
+
+#if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_WHEEL)
+/* Timing wheels of the counters, indexed by OsCounterAlarmsHeadIndex */
+Os_AlarmWheel AlarmWheels[COUNTER_COUNT];
+#endif /* #if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_WHEEL) */
+
+#if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_HEAP)
+/* Alarm heaps of the counters, indexed by OsCounterAlarmsHeadIndex */
+Os_AlarmHeap AlarmHeaps[COUNTER_COUNT];
+#endif /* #if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_HEAP) */
\ No newline at end of file
@@ -7,14 +7,55 @@
 
 #define Task0_ID		0
 #define Task1_ID		1
+/* Without an idle task (OS_CONTEXTLESS_IDLE) the ID is not used by any task */
 #define IdleTaskId (2)
 
 #define Alarm0		0
+#define Alarm1		1
+#define Alarm2		2
+
+/* Counter0: 1 ms SysTick, Counter1: 10 ms timer channel 0, Counter2: 100 ms software
+   counter incremented by Alarm2 */
+#define Counter0		0
+#define Counter1		1
+#define Counter2		2
+
+#define SchedTbl0		0
+
+#define Aes_DoneIsr_ID		0
+#define Timer_Ch0Isr_ID		1
 
 
 
 #define OSDEFAULTAPPMODE                                0
 
+/* Longest lock duration per call site of the interrupt lock services */
+#if (!defined OS_INT_LOCK_MEASURE)
+#define OS_INT_LOCK_MEASURE                             STD_OFF
+#endif /* #if (!defined OS_INT_LOCK_MEASURE) */
+
+/* Queue of the active alarms of a counter: OS_ALARM_QUEUE_LIST, OS_ALARM_QUEUE_WHEEL,
+   OS_ALARM_QUEUE_HEAP or OS_ALARM_QUEUE_DELTA */
+#if (!defined OS_ALARM_QUEUE)
+#define OS_ALARM_QUEUE                                  OS_ALARM_QUEUE_LIST
+#endif /* #if (!defined OS_ALARM_QUEUE) */
+
+/* Timing wheel: 2^OS_ALARM_WHEEL_SLOT_BITS slots per level, the alarms further than
+   2^(OS_ALARM_WHEEL_SLOT_BITS * OS_ALARM_WHEEL_LEVELS) ticks wait in an overflow list */
+#define OS_ALARM_WHEEL_SLOT_BITS                        (6U)
+#define OS_ALARM_WHEEL_LEVELS                           (3U)
+
+/* Min-heap: largest number of alarms of one counter */
+#if (!defined OS_ALARM_HEAP_SIZE)
+#define OS_ALARM_HEAP_SIZE                              (2U)
+#endif /* #if (!defined OS_ALARM_HEAP_SIZE) */
+
+/* Timer slack: an alarm with a slack of N ticks may be delayed by up to N ticks to
+   expire on the tick of an alarm already queued (OsAlarmSlack) */
+#if (!defined OS_ALARM_SLACK)
+#define OS_ALARM_SLACK                                  STD_OFF
+#endif /* #if (!defined OS_ALARM_SLACK) */
+
 
 
 #endif /* #if (!defined OS_CFG_H) */
\ No newline at end of file
@@ -3,8 +3,17 @@
 
 #define START_OS_DUMMY_STACK                     		(0x20016C00)
 
-/* total number of tasks created by the user */
+/* Contextless idle: the dispatcher waits for a ready task, no idle task is configured */
+#if (!defined OS_CONTEXTLESS_IDLE)
+#define OS_CONTEXTLESS_IDLE                             STD_OFF
+#endif /* #if (!defined OS_CONTEXTLESS_IDLE) */
+
+/* total number of tasks created by the user, plus the idle task */
+#if (OS_CONTEXTLESS_IDLE == STD_ON)
+#define TASK_COUNT                                      (0x02U)
+#else
 #define TASK_COUNT                                      ((0x02U) + 1)
+#endif /* #if (OS_CONTEXTLESS_IDLE == STD_ON) */
 
 /* number of priority levels assigned by the user */
 #define PRIORITY_LEVELS                                 (0x02U)
@@ -31,9 +40,58 @@
 
 #define MAX_NO_APPMODES									(0x01U)
 
-#define COUNTER_COUNT                                   (0x01U)
+#define COUNTER_COUNT                                   (0x03U)
 
-#define ALARM_COUNT                                     (0x01U)
+/* Largest number of software counters cascaded by ALARM_INCREMENT_COUNTER alarms above a
+   hardware counter, bounds the nesting of the alarm expiries */
+#define OS_COUNTER_CASCADE_DEPTH                        (0x02U)
+
+#define ALARM_COUNT                                     (0x03U)
+
+#define SCHEDULE_TABLE_COUNT                            (0x01U)
+
+/* Tickless idle: the tick source is reprogrammed to the next alarm expiry of Counters[0] */
+#if (!defined OS_TICKLESS_IDLE)
+#define OS_TICKLESS_IDLE                                STD_OFF
+#endif /* #if (!defined OS_TICKLESS_IDLE) */
+
+/* Counters[0] counts a free-running timer, its compare interrupt is only programmed for the
+   next alarm expiry: one counter tick per timer count and no periodic tick */
+#if (!defined OS_COUNTER_COMPARE_TIMER)
+#define OS_COUNTER_COMPARE_TIMER                        STD_OFF
+#endif /* #if (!defined OS_COUNTER_COMPARE_TIMER) */
+
+/* SysTick only counts the ticks of Counters[0] and pends the deferred expiry handler when an
+   alarm or an expiry point falls due, the expiries run in that handler */
+#if (!defined OS_TICK_DEFERRED)
+#define OS_TICK_DEFERRED                                STD_OFF
+#endif /* #if (!defined OS_TICK_DEFERRED) */
+
+/* Free interrupt pended by SysTick for the deferred expiry handler (OS_TICK_DEFERRED) */
+#define OS_TICK_DEFERRED_IRQ                            (0x05U)
+
+/* Number of priority bits implemented by the NVIC of the device */
+#define OS_NVIC_PRIO_BITS                               (4U)
+
+/* Number of external interrupts of the NVIC of the device */
+#define OS_NVIC_IRQ_COUNT                               (0x10U)
+
+/* total number of ISRs (Category 1 and 2) created by the user */
+#define ISR_COUNT                                       (0x02U)
+
+/* Most urgent (lowest value) NVIC priority of the Category 2 ISRs, the kernel masks the
+   interrupts from this priority down. Category 1 ISRs use the values below it. */
+#define OS_CAT2_ISR_HIGHEST_PRIORITY                    (0x04U)
+
+/* Alignment of the vector table required by VTOR: (16 + OS_NVIC_IRQ_COUNT) words
+   rounded up to a power of two, at least 128 bytes */
+#define OS_VECTOR_TABLE_ALIGNMENT                       (128)
+
+/* MPU isolation of the tasks, static and task regions are configured in Os_Cfg.c */
+#define OS_MPU_PROTECTION                               STD_OFF
+
+/* Measures the cycles of the task region reload on every context switch */
+#define OS_MPU_MEASURE_SWITCH                           STD_OFF
 
 extern Os_Task 	   Tasks[TASK_COUNT];
 
@@ -45,10 +103,38 @@ extern Os_AppMode ApplicationModes[MAX_NO_APPMODES];
 
 extern Os_Alarm* ActiveAlarmsHead[COUNTER_COUNT];
 
+#if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_WHEEL)
+extern Os_AlarmWheel AlarmWheels[COUNTER_COUNT];
+#endif /* #if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_WHEEL) */
+
+#if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_HEAP)
+extern Os_AlarmHeap AlarmHeaps[COUNTER_COUNT];
+#endif /* #if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_HEAP) */
+
 
 extern Os_Counter Counters[COUNTER_COUNT];
 
+extern Os_CounterTime CounterTimes[COUNTER_COUNT];
+
 
 extern Os_Alarm Alarms[ALARM_COUNT];
 
+#if (SCHEDULE_TABLE_COUNT > 0)
+extern Os_ScheduleTable ScheduleTables[SCHEDULE_TABLE_COUNT];
+
+extern Os_ScheduleTable* ScheduleTablesHead[COUNTER_COUNT];
+#endif /* #if (SCHEDULE_TABLE_COUNT > 0) */
+
+#if (ISR_COUNT > 0)
+extern CONST(Os_Isr, OS_CONST) Isrs[ISR_COUNT];
+#endif /* #if (ISR_COUNT > 0) */
+
+#if (OS_ARCH == OS_ARM)
+extern CONST(Os_VectorType, OS_CONST) Os_VectorTable[OS_CORE_VECTOR_COUNT + OS_NVIC_IRQ_COUNT];
+#endif /* #if (OS_ARCH == OS_ARM) */
+
+#if (OS_MPU_PROTECTION == STD_ON)
+extern CONST(Os_MpuRegionType, OS_CONST) OsMpuStaticRegions[OS_MPU_STATIC_REGIONS];
+#endif /* #if (OS_MPU_PROTECTION == STD_ON) */
+
 #endif /* #if (!defined OS_INT_CFG_H) */
\ No newline at end of file
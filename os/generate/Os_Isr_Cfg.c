@@ -0,0 +1,99 @@
+/***********************************************************************************/
+/*				    			Interrupt configuration	         				   */
+/***********************************************************************************/
+#include <Os_kernel.h>
+
+#if (OS_ARCH == OS_ARM)
+
+/* Priorities of the ISRs, validated against the kernel lock level */
+#define OS_ISR_PRIORITY_Aes_DoneIsr		(0x01U)
+#define OS_ISR_PRIORITY_Timer_Ch0Isr		(0x04U)
+
+#if (OS_ISR_PRIORITY_Aes_DoneIsr >= OS_CAT2_ISR_HIGHEST_PRIORITY)
+#error Category 1 ISR Aes_DoneIsr shall have a priority above the kernel lock level OS_CAT2_ISR_HIGHEST_PRIORITY
+#endif
+
+#if (OS_ISR_PRIORITY_Timer_Ch0Isr < OS_CAT2_ISR_HIGHEST_PRIORITY)
+#error Category 2 ISR Timer_Ch0Isr shall have a priority masked by the kernel lock level OS_CAT2_ISR_HIGHEST_PRIORITY
+#endif
+
+#if (OS_CAT2_ISR_HIGHEST_PRIORITY >= (1U << OS_NVIC_PRIO_BITS))
+#error OS_CAT2_ISR_HIGHEST_PRIORITY is not a priority of the NVIC
+#endif
+
+/* Category 1 ISR */
+extern void Aes_DoneIsr (void);
+/* Category 2 ISR, tick of Counter1 defined with OS_COUNTER_ISR(Timer_Ch0Isr, Counter1) */
+extern void Timer_Ch0Isr (void);
+
+/* Kernel exceptions */
+extern void SVC_Handler (void);
+extern void PendSV_Handler (void);
+extern void SysTick_Handler (void);
+#if (OS_TICK_DEFERRED == STD_ON)
+/* Deferred expiry handler pended by SysTick, Category 2 */
+extern void CounterTimer_Handler (void);
+#endif /* #if (OS_TICK_DEFERRED == STD_ON) */
+
+CONST(Os_Isr, OS_CONST) Isrs[ISR_COUNT] =
+{
+	{
+		.IsrHandler = Aes_DoneIsr,
+		.IsrIrqNumber = 2,
+		.IsrCategory = OS_ISR_CATEGORY_1,
+		.IsrPriority = OS_ISR_PRIORITY_Aes_DoneIsr
+	},
+	{
+		.IsrHandler = Timer_Ch0Isr,
+		.IsrIrqNumber = 4,
+		.IsrCategory = OS_ISR_CATEGORY_2,
+		.IsrPriority = OS_ISR_PRIORITY_Timer_Ch0Isr
+	}
+};
+
+/* Entries 0 and 1 are only read at reset, the table is installed by VTOR in StartOS */
+IFX_SECTION(".os_vectors", OS_VECTOR_TABLE_ALIGNMENT)
+CONST(Os_VectorType, OS_CONST) Os_VectorTable[OS_CORE_VECTOR_COUNT + OS_NVIC_IRQ_COUNT] =
+{
+	/* System exceptions */
+	(Os_VectorType)START_OS_DUMMY_STACK,	/* Initial stack pointer */
+	Os_UnhandledInterrupt,					/* Reset */
+	Os_UnhandledInterrupt,					/* NMI */
+	Os_UnhandledInterrupt,					/* HardFault */
+	Os_UnhandledInterrupt,					/* MemManage */
+	Os_UnhandledInterrupt,					/* BusFault */
+	Os_UnhandledInterrupt,					/* UsageFault */
+	NULL_PTR,								/* Reserved */
+	NULL_PTR,								/* Reserved */
+	NULL_PTR,								/* Reserved */
+	NULL_PTR,								/* Reserved */
+	SVC_Handler,							/* SVCall */
+	Os_UnhandledInterrupt,					/* DebugMonitor */
+	NULL_PTR,								/* Reserved */
+	PendSV_Handler,							/* PendSV */
+	SysTick_Handler,						/* SysTick, Category 2 (OS_TICK_DEFERRED: counts only) */
+
+	/* External interrupts */
+	Os_UnhandledInterrupt,					/* IRQ 0 */
+	Os_UnhandledInterrupt,					/* IRQ 1 */
+	Aes_DoneIsr,							/* IRQ 2, Category 1 */
+	Os_UnhandledInterrupt,					/* IRQ 3 */
+	Timer_Ch0Isr,							/* IRQ 4, Category 2 */
+#if (OS_TICK_DEFERRED == STD_ON)
+	CounterTimer_Handler,					/* IRQ 5 (OS_TICK_DEFERRED_IRQ), Category 2 */
+#else
+	Os_UnhandledInterrupt,					/* IRQ 5 */
+#endif /* #if (OS_TICK_DEFERRED == STD_ON) */
+	Os_UnhandledInterrupt,					/* IRQ 6 */
+	Os_UnhandledInterrupt,					/* IRQ 7 */
+	Os_UnhandledInterrupt,					/* IRQ 8 */
+	Os_UnhandledInterrupt,					/* IRQ 9 */
+	Os_UnhandledInterrupt,					/* IRQ 10 */
+	Os_UnhandledInterrupt,					/* IRQ 11 */
+	Os_UnhandledInterrupt,					/* IRQ 12 */
+	Os_UnhandledInterrupt,					/* IRQ 13 */
+	Os_UnhandledInterrupt,					/* IRQ 14 */
+	Os_UnhandledInterrupt					/* IRQ 15 */
+};
+
+#endif /* #if (OS_ARCH == OS_ARM) */
@@ -25,6 +25,10 @@
 /* main defined data types used inclusion */
 #include <Os_Types.h>
 #include <Os_syscalls.h>
+/* ISR(name) declaration of the Category 2 ISRs */
+#include <Os_kernel_isr.h>
+/* Interrupt lock services */
+#include <Os_kernel_intlock.h>
 
 
 /***********************************************************************************/
@@ -100,9 +104,8 @@
  * @{
  */
 
-#define OS_SYSTEM_TYPE	OS_SYSTEM_CALL
-
-#if (OS_SYSTEM_TYPE == OS_SYSTEM_CALL)
+/* The entry stubs select the system call or the trusted direct call (OS_SYSTEM_TYPE, Os_syscalls.h) */
+#if ((OS_SYSTEM_TYPE == OS_SYSTEM_CALL) || (OS_SYSTEM_TYPE == OS_FUNCTION_CALL) || (OS_SYSTEM_TYPE == OS_MIXED_CALL))
 
 #define ActivateTask(TaskID)						SVC_ActivateTask(TaskID)		
 #define ChainTask(TaskID)								SVC_ChainTask(TaskID)
@@ -122,8 +125,34 @@
 #define SetAbsAlarm(AlarmID, Start, Cycle) SVC_SetAbsAlarm(AlarmID, Start, Cycle)
 #define CancelAlarm(AlarmID)						SVC_CancelAlarm(AlarmID)
 
-#define StartOS(Mode)          				 	SVC_StartOS(Mode)
+/* Read from the time snapshots of the counters, without system call */
+#define GetCounterValue(CounterID, Value)				OS_GetCounterValue(CounterID, Value)
+#define GetElapsedValue(CounterID, Value, ElapsedValue)	OS_GetElapsedValue(CounterID, Value, ElapsedValue)
+#define GetCounterValueExtended(CounterID, Value)		OS_GetCounterValueExtended(CounterID, Value)
 
+#define StartScheduleTableRel(ScheduleTableID, Offset)	SVC_StartScheduleTableRel(ScheduleTableID, Offset)
+#define StartScheduleTableAbs(ScheduleTableID, Start)	SVC_StartScheduleTableAbs(ScheduleTableID, Start)
+#define StopScheduleTable(ScheduleTableID)				SVC_StopScheduleTable(ScheduleTableID)
+#define NextScheduleTable(From, To)						SVC_NextScheduleTable(From, To)
+#define GetScheduleTableStatus(ScheduleTableID, Status)	SVC_GetScheduleTableStatus(ScheduleTableID, Status)
+#define StartScheduleTableSynchron(ScheduleTableID)		SVC_StartScheduleTableSynchron(ScheduleTableID)
+#define SyncScheduleTable(ScheduleTableID, Value)		SVC_SyncScheduleTable(ScheduleTableID, Value)
+#define SetScheduleTableAsync(ScheduleTableID)			SVC_SetScheduleTableAsync(ScheduleTableID)
+
+#define StartOS(Mode)          				 	SVC_StartOS(Mode)
+#define ShutdownOS(Error)						((void)SVC_ShutdownOS(Error))
+#define RestartOS(Mode)							SVC_RestartOS(Mode)
+
+/* Interrupt locks, inline in the caller (Os_kernel_intlock.h) */
+#define DisableAllInterrupts()					OS_DisableAllInterrupts(OS_INT_LOCK_SITE())
+#define EnableAllInterrupts()					OS_EnableAllInterrupts()
+#define SuspendAllInterrupts()					OS_SuspendAllInterrupts(OS_INT_LOCK_SITE())
+#define ResumeAllInterrupts()					OS_ResumeAllInterrupts()
+#define SuspendOSInterrupts()					OS_SuspendOSInterrupts(OS_INT_LOCK_SITE())
+#define ResumeOSInterrupts()					OS_ResumeOSInterrupts()
+
+#else
+#error OS_SYSTEM_TYPE shall be OS_SYSTEM_CALL, OS_FUNCTION_CALL or OS_MIXED_CALL
 #endif
 
 
@@ -165,6 +194,27 @@
  * @{
  */
 
+/* Counter reads mapped by GetCounterValue, GetElapsedValue and GetCounterValueExtended,
+   called in the caller without system call (Counters.c) */
+extern FUNC(StatusType, OS_CODE) OS_GetCounterValue
+(
+	CONST(CounterType, AUTOMATIC) CounterID,
+	CONST(TickRefType, AUTOMATIC) Value
+);
+
+extern FUNC(StatusType, OS_CODE) OS_GetElapsedValue
+(
+	CONST(CounterType, AUTOMATIC) CounterID,
+	CONST(TickRefType, AUTOMATIC) Value,
+	CONST(TickRefType, AUTOMATIC) ElapsedValue
+);
+
+extern FUNC(StatusType, OS_CODE) OS_GetCounterValueExtended
+(
+	CONST(CounterType, AUTOMATIC) CounterID,
+	CONST(ExtendedTickRefType, AUTOMATIC) Value
+);
+
 
 
 /**********************************************************************************
@@ -423,6 +473,79 @@
  */
 
 
+/**********************************************************************************
+**	Service name:       ShutdownOS                        					     **
+**	                                                      						 **
+**	Syntax:	            void ShutdownOS(                                         **
+**                          StatusType Error                                     **
+**                      )    												     **
+**				  																 **
+**  Description :       Aborts the overall system, calls the ShutdownHook and    **
+**                      halts the core with all interrupts disabled.             **
+**				 																 **
+**	Service ID:         -                           							 **
+**                                                        						 **
+**	Sync/Async:	        Synchronous      						 				 **
+**																				 **
+**  Reentrancy:         Reentrant                                      			 **
+**                                                        						 **
+**	Parameters (in): 	Error - Error occurred									 **
+**                                                                               **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA                                                  	 **
+**                                                                               **
+**	Return value:    	None, the service does not return					     **
+**                                                                               **
+**  Conformance:        BCC1, BCC2, ECC1, ECC2			 					     **    
+***********************************************************************************/
+/**
+ * @brief Shuts the operating system down.
+ *
+ * @param[in]  Error          Error occurred, handed to the ShutdownHook
+ */
+
+
+/**********************************************************************************
+**	Service name:       RestartOS                        					     **
+**	                                                      						 **
+**	Syntax:	            StatusType RestartOS(                                    **
+**                          AppModeType Mode                                     **
+**                      )    												     **
+**				  																 **
+**  Description :       Shuts the operating system down and starts it again in   **
+**                      <Mode> without a reset (warm restart).                   **
+**				 																 **
+**	Service ID:         -                           							 **
+**                                                        						 **
+**	Sync/Async:	        Synchronous      						 				 **
+**																				 **
+**  Reentrancy:         Non Reentrant                                  			 **
+**                                                        						 **
+**	Parameters (in): 	Mode - Application mode of the restart					 **
+**                                                                               **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA                                                  	 **
+**                                                                               **
+**	Return value:    	StatusType, only on error							     **
+**      Standard:       • <Mode> is not configured, E_OS_ID                      **
+**                      • Call at interrupt level, E_OS_CALLEVEL                 **
+**                                                                               **
+**  Conformance:        BCC1, BCC2, ECC1, ECC2			 					     **    
+***********************************************************************************/
+/**
+ * @brief Warm restart of the operating system in another application mode.
+ *
+ * The ShutdownHook is called with E_OK, the kernel data is re-initialised by StartOS
+ * and the autostart tasks and alarms of <Mode> are started. The calling task is
+ * abandoned, the service only returns on error.
+ *
+ * @param[in]  Mode           Application mode of the restart
+ * @return     StatusType     E_OS_ID or E_OS_CALLEVEL
+ */
+
+
 
 /** @} */  /*End of ExternalFunctionsDeclration*/ 
 
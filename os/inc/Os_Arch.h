@@ -25,14 +25,17 @@
 /*! inclusion of important os definitions  */
 #include <Os_definitions.h>
 
-#if (defined OS_ARCH) 
-#error OS_ARCH already defined!
-#endif /*#if( defined OS_ARCH)*/
+/* The target architecture is selected by the build (-DOS_ARCH=...), ARM by default */
+#if (!defined OS_ARCH) 
+#define OS_ARCH							OS_ARM
+#endif /*#if(!defined OS_ARCH)*/
 
 #if (OS_ARCH == OS_ARM)
 #include <Os_kernel_cm4.h>
 #elif (OS_ARCH == OS_TRICORE)
 #include <Os_kernel_tricore.h>	
+#elif (OS_ARCH == OS_POSIX)
+#include <Os_kernel_posix.h>
 #else 
 #error "Unsupported CPU family"
 #endif
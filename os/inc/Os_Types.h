@@ -216,6 +216,12 @@ typedef VAR(uint32, TYPEDEF) TickType;
 /*! This data type points to the data type TickType. */
 typedef P2VAR(TickType, TYPEDEF, OS_APPL_DATA) TickRefType;
 
+/*! Counter value in ticks since StartOS, extended to 64 bits: it does not wrap. */
+typedef VAR(uint64, TYPEDEF) ExtendedTickType;
+
+/*! This data type points to the data type ExtendedTickType. */
+typedef P2VAR(ExtendedTickType, TYPEDEF, OS_APPL_DATA) ExtendedTickRefType;
+
 /*! This data type represents a structure for storage of counter characteristics */
 typedef struct AlarmBaseType_s AlarmBaseType;
 
@@ -244,6 +250,15 @@ struct AlarmBaseType_s
 /*! This data type represents an counter object. */
 typedef VAR(uint8,TYPEDEF) CounterType; 
 
+/*! This data type identifies a schedule table. */
+typedef VAR(uint8,TYPEDEF) ScheduleTableType;
+
+/*! This data type describes the status of a schedule table (SCHEDULETABLE_xxx). */
+typedef VAR(uint8,TYPEDEF) ScheduleTableStatusType;
+
+/*! This data type points to a variable of the data type ScheduleTableStatusType. */
+typedef P2VAR(ScheduleTableStatusType, TYPEDEF, OS_APPL_DATA) ScheduleTableStatusRefType;
+
 
 
 #if(!defined STATUSTYPEDEFINED)
@@ -49,6 +49,12 @@
 /*! */
 #define OS_TRICORE						(0x01U)
 
+#if (defined OS_POSIX) 
+#error OS_POSIX already defined!
+#endif /*#if( defined OS_POSIX)*/
+/*! Host simulation port (x86-64 Linux) */
+#define OS_POSIX						(0x02U)
+
 
 	
 #if (defined ERROR_CHECKING_STANDARD) 
@@ -94,6 +100,12 @@
 /*! */
 #define OS_SYSTEM_CALL     (0x01U)
 
+#if (defined OS_MIXED_CALL) 
+#error OS_MIXED_CALL already defined!
+#endif /*#if( defined OS_MIXED_CALL)*/
+/*! Trusted tasks call the kernel directly, the other tasks use the system call */
+#define OS_MIXED_CALL      (0x02U)
+
 #define BCC1_CLASS                           (0x00U)
 #define BCC2_CLASS                           (0x01U)
 #define ECC1_CLASS                           (0x02U)
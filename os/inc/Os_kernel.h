@@ -38,14 +38,20 @@
 #include <Os_kernel_counter.h>
 /*! Os Alarm header file inclusion */
 #include <Os_kernel_alarm.h>
+/*! Os Schedule table header file inclusion */
+#include <Os_kernel_schedtbl.h>
 /*! Os kernel APIs main header file */
 #include <Os_kernel_api.h>
+/*! Os Category 2 ISR header file inclusion */
+#include <Os_kernel_isr.h>
 /*! Os configurations Macros */
 #include <Os_Cfg.h>
 /*! Os internal configurations */
 #include <Os_Int_Cfg.h>
+#if (OS_ARCH == OS_ARM)
 /*!Tasking Compiler inclusion */
 #include <Ifx_Compiler.h>
+#endif /* #if (OS_ARCH == OS_ARM) */
 /*! Os Queues header file inclusion */
 #include <queue.h>
 /*! Os Priority Queues header file inclusion */
@@ -61,6 +67,17 @@
 /*                                  MACROS                                         */
 /***********************************************************************************/
 
+/*! Counters[0] is driven by the counter timer driver (Os_CounterTimer.c): the compare timer
+    or the ticks counted by SysTick for the deferred expiry handler */
+#if (defined OS_COUNTER_TIMER_DRIVER)
+#error OS_COUNTER_TIMER_DRIVER already defined!
+#endif /*#if( defined OS_COUNTER_TIMER_DRIVER)*/
+#if ((OS_COUNTER_COMPARE_TIMER == STD_ON) || (OS_TICK_DEFERRED == STD_ON))
+#define OS_COUNTER_TIMER_DRIVER                     STD_ON
+#else
+#define OS_COUNTER_TIMER_DRIVER                     STD_OFF
+#endif /* #if ((OS_COUNTER_COMPARE_TIMER == STD_ON) || (OS_TICK_DEFERRED == STD_ON)) */
+
 
 
 /***********************************************************************************/
@@ -18,6 +18,8 @@
 /**********************************************************************************/
 /*                               INCLUDE HEADERS	                              */  
 /**********************************************************************************/
+/* OS_ALARM_QUEUE and the timing wheel dimensions */
+#include <Os_Cfg.h>
 
 
 /***********************************************************************************/
@@ -53,6 +55,12 @@
 #endif /*#if( defined ALARM_CALLBACK)*/
 #define ALARM_CALLBACK			(0x02U)	
 
+/*! The alarm increments a software counter (cascaded counters).*/
+#if (defined ALARM_INCREMENT_COUNTER)
+#error ALARM_INCREMENT_COUNTER already defined!
+#endif /*#if( defined ALARM_INCREMENT_COUNTER)*/
+#define ALARM_INCREMENT_COUNTER	(0x03U)
+
 
 #if (defined ALARM_RELATIVE)
 #error ALARM_RELATIVE already defined!
@@ -65,6 +73,37 @@
 #define ALARM_ABSOLUTE		(0x01U)
 
 
+/*! Alarm queue of a counter: list sorted by expiry time, O(n) insertion.*/
+#if (defined OS_ALARM_QUEUE_LIST)
+#error OS_ALARM_QUEUE_LIST already defined!
+#endif /*#if( defined OS_ALARM_QUEUE_LIST)*/
+#define OS_ALARM_QUEUE_LIST		(0x00U)
+
+/*! Alarm queue of a counter: hierarchical timing wheel, O(1) insertion and removal.*/
+#if (defined OS_ALARM_QUEUE_WHEEL)
+#error OS_ALARM_QUEUE_WHEEL already defined!
+#endif /*#if( defined OS_ALARM_QUEUE_WHEEL)*/
+#define OS_ALARM_QUEUE_WHEEL	(0x01U)
+
+/*! Alarm queue of a counter: binary min-heap, O(log n) insertion and removal.*/
+#if (defined OS_ALARM_QUEUE_HEAP)
+#error OS_ALARM_QUEUE_HEAP already defined!
+#endif /*#if( defined OS_ALARM_QUEUE_HEAP)*/
+#define OS_ALARM_QUEUE_HEAP		(0x02U)
+
+/*! Alarm queue of a counter: list of the ticks between consecutive expiries, O(1) tick.*/
+#if (defined OS_ALARM_QUEUE_DELTA)
+#error OS_ALARM_QUEUE_DELTA already defined!
+#endif /*#if( defined OS_ALARM_QUEUE_DELTA)*/
+#define OS_ALARM_QUEUE_DELTA	(0x03U)
+
+/*! Heap position of an alarm that is not queued.*/
+#if (defined OS_ALARM_HEAP_NONE)
+#error OS_ALARM_HEAP_NONE already defined!
+#endif /*#if( defined OS_ALARM_HEAP_NONE)*/
+#define OS_ALARM_HEAP_NONE		(0xFFFFU)
+
+
 /*************************************************************************************/
 /*                                 TypeDefnitions                                    */
 /*************************************************************************************/
@@ -84,6 +123,9 @@ typedef struct Os_AlarmSetEvent_s 			Os_AlarmSetEvent;
 /* Os_AlarmCallback structure */
 typedef struct Os_AlarmCallback_s 			Os_AlarmCallback;
 
+/* Os_AlarmIncrementCounter structure */
+typedef struct Os_AlarmIncrementCounter_s	Os_AlarmIncrementCounter;
+
 /* Pointer to a function type for call-back function */
 typedef P2FUNC(void,OS_CONST,CallbackFuncPtrType)(void);
 
@@ -99,6 +141,9 @@ union Os_AlarmAction_u
 
     /*! Specifies the parameters to call a callback OS alarm action.*/
 	CONST(CallbackFuncPtrType,OS_CONST)	                OsAlarmCallbackName;
+
+	/*! Specifies the counter incremented by the alarm.*/
+	P2VAR(Os_AlarmIncrementCounter,TYPEDEF, OS_CODE)	OsAlarmIncrementCounter;
 };
 
 struct Os_Alarm_s
@@ -122,20 +167,93 @@ struct Os_Alarm_s
 	/*! Reference to the counter that the alarm is based on.*/
 	P2VAR(Os_Counter,TYPEDEF,OS_CONST)		         OsAlarmCounterRef;
 
+#if (OS_ALARM_QUEUE != OS_ALARM_QUEUE_HEAP)
     /* Next Item */
 	P2VAR(Os_Alarm,TYPEDEF,OS_CONST)				OsAlarmNext;
 
 	/* Previous Item */
 	P2VAR(Os_Alarm,TYPEDEF,OS_CONST)				OsAlarmPrevious;
+#else
+	/* Position in the heap of the counter, OS_ALARM_HEAP_NONE if not queued */
+	VAR(uint16, TYPEDEF)                            OsAlarmHeapIndex;
+#endif /* #if (OS_ALARM_QUEUE != OS_ALARM_QUEUE_HEAP) */
 
-    /* Alarm Time fro Auto Start Alarms */
-	VAR(uint8, TYPEDEF)                             OsAlarmAlarmTime;
+    /* Alarm Time fro Auto Start Alarms, the first expiry placed by the generator (make phase) */
+	VAR(TickType, TYPEDEF)                          OsAlarmAlarmTime;
 
 	/* Alarm Auto Start Type */
 	VAR(uint8, TYPEDEF)                             OsAlarmAutoStartType;
 
+#if (OS_ALARM_SLACK == STD_ON)
+	/* Ticks the expiry may be delayed to share the tick of a queued alarm, 0 for none */
+	VAR(TickType, TYPEDEF)                          OsAlarmSlack;
+
+	/* Expiry before the slack was applied, the cycles count from it */
+	VAR(TickType, TYPEDEF)                          OsAlarmNominalTime;
+#endif /* #if (OS_ALARM_SLACK == STD_ON) */
+
+#if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_WHEEL)
+	/* Expiry in wheel ticks (Os_AlarmWheel.Now), does not wrap with the counter */
+	VAR(uint32, TYPEDEF)                            OsAlarmWheelTime;
+
+	/* Slot (or overflow list) of the wheel holding the alarm */
+	P2VAR(Os_Alarm *, TYPEDEF, OS_VAR)              OsAlarmSlot;
+#endif /* #if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_WHEEL) */
+
+#if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_DELTA)
+	/* Ticks after the expiry of the previous alarm of the list, after the current
+	   counter value for the head */
+	VAR(TickType, TYPEDEF)                          OsAlarmDelta;
+#endif /* #if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_DELTA) */
 };
 
+#if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_WHEEL)
+/**
+ * @brief Hierarchical timing wheel of the alarms of one counter.
+ *
+ * Level L holds the alarms expiring in [2^(L*bits), 2^((L+1)*bits)) wheel ticks, in the
+ * slot of bits [L*bits, (L+1)*bits) of their expiry. A slot of level L > 0 is cascaded
+ * to the lower levels when the low L*bits of Now become 0. Every slot is a circular
+ * list through OsAlarmNext / OsAlarmPrevious, the alarms of a slot expire in insertion order.
+ */
+typedef struct
+{
+	/*! Wheel ticks since the start, counts with the counter without its wrap */
+	VAR(uint32, TYPEDEF)                            Now;
+
+	/*! Number of alarms in the wheel */
+	VAR(uint32, TYPEDEF)                            Count;
+
+	/*! Slots of the levels */
+	P2VAR(Os_Alarm, TYPEDEF, OS_VAR)                Slots[OS_ALARM_WHEEL_LEVELS][1UL << OS_ALARM_WHEEL_SLOT_BITS];
+
+	/*! Alarms beyond the span of the wheel, placed again at every turn of the last level */
+	P2VAR(Os_Alarm, TYPEDEF, OS_VAR)                Overflow;
+} Os_AlarmWheel;
+#endif /* #if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_WHEEL) */
+
+#if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_HEAP)
+/**
+ * @brief Binary min-heap of the alarms of one counter.
+ *
+ * The key of an alarm is its number of ticks to expiry counted from the counter value
+ * Last, the value of the last expiry pass, so the order of the queued alarms does not
+ * change while the counter advances. Items[0] expires first, the children of Items[i]
+ * are Items[2i+1] and Items[2i+2].
+ */
+typedef struct
+{
+	/*! Counter value of the last expiry pass */
+	VAR(TickType, TYPEDEF)                          Last;
+
+	/*! Number of alarms in the heap */
+	VAR(uint16, TYPEDEF)                            Count;
+
+	/*! Queued alarms */
+	P2VAR(Os_Alarm, TYPEDEF, OS_VAR)                Items[OS_ALARM_HEAP_SIZE];
+} Os_AlarmHeap;
+#endif /* #if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_HEAP) */
+
 
 struct Os_AlarmActivateTask_s
 {
@@ -152,6 +270,20 @@ struct Os_AlarmSetEvent_s
 	VAR(EventMaskType,TYPEDEF)		OsAlarmSetEventRef;
 };
 
+/**
+ * @brief Counter incremented by an ALARM_INCREMENT_COUNTER alarm.
+ *
+ * Generation constraints: the counter is a software counter of a higher cascade level
+ * than the counter of the alarm (the increments never form a cycle), at most
+ * OS_COUNTER_CASCADE_DEPTH levels above a hardware counter (bounded nesting of the
+ * expiries).
+ */
+struct Os_AlarmIncrementCounter_s
+{
+	/*! Reference to the software counter incremented by that alarm action.*/
+	VAR(CounterType,TYPEDEF)		OsAlarmIncrementCounterRef;
+};
+
 
 
 
@@ -179,6 +311,7 @@ struct Os_AlarmSetEvent_s
 /*                        Internal Function Declration                             */
 /***********************************************************************************/
 
+#if (OS_ALARM_QUEUE != OS_ALARM_QUEUE_HEAP)
 /**
  * @brief Inserts a new alarm into the alarm list.
  *
@@ -226,6 +359,7 @@ OS_AlarmRemove
     P2VAR(Os_Alarm *, OS_CODE, TYPEDEF) Head,
     P2VAR(Os_Alarm, OS_CODE, TYPEDEF) AlarmToRemove
 );
+#endif /* #if (OS_ALARM_QUEUE != OS_ALARM_QUEUE_HEAP) */
 
 
 /**
@@ -239,6 +373,117 @@ OS_AlarmFireAction
     P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm
 );
 
+/**
+ * @brief Expiry of an alarm removed from its queue: a cyclic alarm is queued again
+ * <OsAlarmCycleTime> ticks later, a single alarm goes to sleep, then the action fires.
+ *
+ * @param Alarm Pointer to the expired alarm.
+ */
+extern FUNC(void, OS_CODE)
+OS_AlarmExpire
+(
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm
+);
+
+/*
+    Alarm queue of a counter, implemented by Alarms.c (OS_ALARM_QUEUE_LIST) or by
+    Os_AlarmWheel.c (OS_ALARM_QUEUE_WHEEL), Os_AlarmHeap.c (OS_ALARM_QUEUE_HEAP) or
+    Os_AlarmDelta.c (OS_ALARM_QUEUE_DELTA).
+    Called with the kernel locked.
+*/
+
+/**
+ * @brief Empties the alarm queue of <Counter>.
+ */
+extern FUNC(void, OS_CODE)
+OS_AlarmQueueInit
+(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter
+);
+
+/**
+ * @brief Queues <Alarm> on its counter to expire at OsAlarmExpiryTime, a whole counter
+ * period later if that is the current counter value.
+ */
+extern FUNC(void, OS_CODE)
+OS_AlarmQueueInsert
+(
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm
+);
+
+/**
+ * @brief Removes the queued <Alarm> from the queue of its counter.
+ */
+extern FUNC(void, OS_CODE)
+OS_AlarmQueueRemove
+(
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm
+);
+
+/**
+ * @brief Expires the alarms of <Counter> due at its current value, called after every
+ * increment of the counter.
+ */
+extern FUNC(void, OS_CODE)
+OS_AlarmQueueTick
+(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter
+);
+
+/**
+ * @brief Ticks from the current value of <Counter> during which it may advance without
+ * OS_AlarmQueueTick, 0 if no alarm is queued. The last of these ticks can expire an
+ * alarm and must be counted with OS_AlarmQueueTick.
+ */
+extern FUNC(TickType, OS_CODE)
+OS_AlarmQueueNextExpiry
+(
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter
+);
+
+/**
+ * @brief Follows <Ticks> increments of <Counter> done without OS_AlarmQueueTick, fewer
+ * than returned by OS_AlarmQueueNextExpiry (tickless idle).
+ */
+extern FUNC(void, OS_CODE)
+OS_AlarmQueueSkip
+(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter,
+    CONST(TickType, AUTOMATIC) Ticks
+);
+
+/**
+ * @brief Ticks from the current value of its counter to the expiry of the queued <Alarm>
+ * (GetAlarm).
+ */
+extern FUNC(TickType, OS_CODE)
+OS_AlarmQueueRemaining
+(
+    P2CONST(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm
+);
+
+/**
+ * @brief Ticks from the current value of <Counter> to the nearest queued expiry in
+ * [From, To] ticks, 0 if there is none (OS_ALARM_SLACK).
+ */
+extern FUNC(TickType, OS_CODE)
+OS_AlarmQueueFindExpiry
+(
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter,
+    CONST(TickType, AUTOMATIC) From,
+    CONST(TickType, AUTOMATIC) To
+);
+
+/**
+ * @brief Applies the slack of <Alarm> before it is queued: its expiry moves to the
+ * nearest queued expiry at most OsAlarmSlack ticks later, if any (OS_ALARM_SLACK).
+ */
+extern FUNC(void, OS_CODE)
+OS_AlarmCoalesce
+(
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm
+);
+
 /***********************************************************************************/
 /*				    	 Internal Functions Definition		      				   */
 /***********************************************************************************/
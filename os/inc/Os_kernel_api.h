@@ -129,6 +129,24 @@ extern FUNC(void, OS_CODE) OS_StartOS
     CONST(AppModeType, AUTOMATIC) Mode
 );
 
+extern FUNC(StatusType, OS_CODE) OS_ShutdownOS
+(
+    CONST(StatusType, AUTOMATIC) Error
+);
+
+extern FUNC(StatusType, OS_CODE) OS_RestartOS
+(
+    CONST(AppModeType, AUTOMATIC) Mode
+);
+
+#if (SHUTDOWN_HOOK == STD_ON)
+/* Application hook called by ShutdownOS and RestartOS */
+extern FUNC(void, OS_CODE) ShutdownHook
+(
+    CONST(StatusType, AUTOMATIC) Error
+);
+#endif /* #if (SHUTDOWN_HOOK == STD_ON) */
+
 extern FUNC(StatusType, OS_CODE)
 OS_CancelAlarm
 (
@@ -165,6 +183,59 @@ OS_GetAlarmBase
     P2VAR(AlarmBaseType, AUTOMATIC, OS_APPL_DATA) Info
 );
 
+extern FUNC(StatusType, OS_CODE)
+OS_StartScheduleTableRel
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID,
+    CONST(TickType, AUTOMATIC) Offset
+);
+
+extern FUNC(StatusType, OS_CODE)
+OS_StartScheduleTableAbs
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID,
+    CONST(TickType, AUTOMATIC) Start
+);
+
+extern FUNC(StatusType, OS_CODE)
+OS_StopScheduleTable
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID
+);
+
+extern FUNC(StatusType, OS_CODE)
+OS_NextScheduleTable
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID_From,
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID_To
+);
+
+extern FUNC(StatusType, OS_CODE)
+OS_GetScheduleTableStatus
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID,
+    ScheduleTableStatusRefType ScheduleStatus
+);
+
+extern FUNC(StatusType, OS_CODE)
+OS_StartScheduleTableSynchron
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID
+);
+
+extern FUNC(StatusType, OS_CODE)
+OS_SyncScheduleTable
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID,
+    CONST(TickType, AUTOMATIC) Value
+);
+
+extern FUNC(StatusType, OS_CODE)
+OS_SetScheduleTableAsync
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID
+);
+
 /***********************************************************************************/
 /*                        Internal Function Declration                             */
 /***********************************************************************************/
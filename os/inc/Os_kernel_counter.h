@@ -25,6 +25,23 @@
 /****************************** Moudle Version Check ******************************/
 
 /************************** Module Specific Macros ********************************/
+
+/**
+ * @brief Defines <Name> as the Category 2 tick ISR of the hardware counter <CounterID>, the
+ * interrupt of the timer of its driver.
+ *
+ * @code
+ * OS_COUNTER_ISR(Timer_Ch0Isr, Counter1)
+ * @endcode
+ */
+#if (defined OS_COUNTER_ISR)
+#error OS_COUNTER_ISR already defined!
+#endif /*#if( defined OS_COUNTER_ISR)*/
+#define OS_COUNTER_ISR(Name, CounterID)                 \
+    ISR(Name)                                           \
+    {                                                   \
+        OS_CounterDriverTick(&Counters[(CounterID)]);   \
+    }
 #if (defined COUNTER_HARDWARE)
 #error COUNTER_HARDWARE already defined!
 #endif /*#if( defined COUNTER_HARDWARE)*/
@@ -41,6 +58,73 @@
 
 typedef struct Os_Counter_s Os_Counter;
 
+typedef struct Os_CounterDriver_s Os_CounterDriver;
+
+typedef struct Os_CounterTime_s Os_CounterTime;
+
+/**
+ * @brief Tick source of a hardware counter: a timer of the device raising the tick ISR of
+ * the counter (OS_COUNTER_ISR) once per counter tick, at the rate of the counter.
+ *
+ * Counters[0] is driven by SysTick and has no driver, its tick is started by the
+ * application (OS_TICKLESS_IDLE, OS_COUNTER_COMPARE_TIMER and OS_TICK_DEFERRED only apply
+ * to Counters[0]).
+ */
+struct Os_CounterDriver_s
+{
+    /*! Starts the timer at <OsCounterDriverPeriod> and enables its interrupt, called by
+        StartOS. NULL_PTR if the timer is started by the application. */
+    P2FUNC(void, TYPEDEF, OsCounterDriverStart)(P2CONST(Os_CounterDriver, AUTOMATIC, OS_CONST) Driver);
+
+    /*! Acknowledges the tick interrupt of the timer, NULL_PTR if it is cleared by the hardware */
+    P2FUNC(void, TYPEDEF, OsCounterDriverAck)(P2CONST(Os_CounterDriver, AUTOMATIC, OS_CONST) Driver);
+
+    /*! Tick ISR of the counter, defined with OS_COUNTER_ISR */
+    P2FUNC(void, TYPEDEF, OsCounterDriverIsr)(void);
+
+    /*! Channel of the timer */
+    CONST(uint8, TYPEDEF)
+    OsCounterDriverChannel;
+
+    /*! Period of a counter tick in microseconds */
+    CONST(uint32, TYPEDEF)
+    OsCounterDriverPeriod;
+};
+
+/**
+ * @brief Time snapshot of a counter, read by the tasks without a system call
+ * (GetCounterValue, GetElapsedValue, GetCounterValueExtended).
+ *
+ * The kernel copies the counter value on every tick. On a wrap the lap is added to the
+ * epoch with the generation odd (OS_CounterTimeBegin, OS_CounterTimeEnd): a reader takes
+ * the generation, the fields and the generation again, and retries while the generation is
+ * odd or has changed. A tick without wrap costs a single store.
+ *
+ * The snapshots are placed in OS_COUNTER_TIME_SECTION, readable by the tasks.
+ */
+struct Os_CounterTime_s
+{
+    /*! Odd while the kernel updates the snapshot */
+    volatile VAR(uint32, TYPEDEF)
+    OsCounterTimeGeneration;
+
+    /*! OsCounterMaxAllowedValue of the counter, set by StartOS */
+    VAR(TickType, TYPEDEF)
+    OsCounterTimeMaxAllowedValue;
+
+    /*! Current value of the counter */
+    VAR(TickType, TYPEDEF)
+    OsCounterTimeTicks;
+
+    /*! Timer value Counters[0] was last brought up to (OS_COUNTER_TIMER_DRIVER) */
+    VAR(uint32, TYPEDEF)
+    OsCounterTimeTimerLast;
+
+    /*! Extended value of the tick 0 of the current lap of the counter */
+    VAR(ExtendedTickType, TYPEDEF)
+    OsCounterTimeEpoch;
+};
+
 struct Os_Counter_s
 {
 
@@ -68,6 +152,14 @@ struct Os_Counter_s
 
     VAR(uint8, TYPEDEF)
     OsCounterAlarmsHeadIndex;
+
+    /*! Tick source of a hardware counter, NULL_PTR for Counters[0] (SysTick) and the software counters */
+    P2CONST(Os_CounterDriver, TYPEDEF, OS_CONST)
+    OsCounterDriver;
+
+    /*! Time snapshot of the counter, readable by the tasks */
+    P2VAR(Os_CounterTime, TYPEDEF, OS_VAR)
+    OsCounterTime;
 };
 
 /***********************************************************************************/
@@ -88,6 +180,194 @@ OS_IncrementCounter(
     CONST(CounterType, AUTOMATIC) CounterID
 );
 
+/**
+ * @brief Advances <Counter> by <Ticks> ticks at once (missed or skipped ticks), called
+ * with the kernel locked.
+ */
+extern FUNC(void, OS_CODE)
+OS_AdvanceHardwareCounter
+(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter,
+    CONST(TickType, AUTOMATIC) Ticks
+);
+
+extern FUNC(StatusType, OS_CODE)
+OS_AdvanceCounter(
+    CONST(CounterType, AUTOMATIC) CounterID,
+    CONST(TickType, AUTOMATIC) Ticks
+);
+
+/**
+ * @brief Starts the tick source of <Counter>, does nothing for a counter without driver.
+ * Called by StartOS.
+ */
+extern FUNC(void, OS_CODE)
+OS_CounterDriverStart
+(
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter
+);
+
+/**
+ * @brief Body of the tick ISR of <Counter>: acknowledges the timer and increments the
+ * counter, the alarms due expire.
+ */
+extern FUNC(void, OS_CODE)
+OS_CounterDriverTick
+(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter
+);
+
+/**
+ * @brief Sets <Counter> and its time snapshot to 0, called by StartOS.
+ */
+extern FUNC(void, OS_CODE)
+OS_CounterTimeInit
+(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter
+);
+
+/**
+ * @brief Opens an update of the time snapshot of <Counter>: the generation is made odd.
+ * Returns FALSE if an update is already open, the call is then nested in it.
+ */
+extern FUNC(boolean, OS_CODE)
+OS_CounterTimeBegin
+(
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter
+);
+
+/**
+ * @brief Closes the update of the time snapshot of <Counter> opened by OS_CounterTimeBegin
+ * when <Opened> is TRUE.
+ */
+extern FUNC(void, OS_CODE)
+OS_CounterTimeEnd
+(
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter,
+    CONST(boolean, AUTOMATIC) Opened
+);
+
+/**
+ * @brief Ticks from the current value of <Counter> to its next alarm or schedule table
+ * expiry, 0 if none is active.
+ */
+extern FUNC(TickType, OS_CODE)
+OS_CounterNextExpiry
+(
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter
+);
+
+/* Tickless idle (OS_TICKLESS_IDLE), declared unconditionally: this header is included
+   before the configuration headers */
+
+/**
+ * @brief Reprograms the tick source to the next alarm expiry, the idle task runs.
+ */
+extern FUNC(void, OS_CODE) OS_TicklessEnter
+(
+    void
+);
+
+/**
+ * @brief Ends the tickless sleep and adds the ticks that passed to Counters[0].
+ */
+extern FUNC(void, OS_CODE) OS_TicklessLeave
+(
+    void
+);
+
+/**
+ * @brief Port: delays the next tick to <Ticks> ticks after the last tick boundary, within
+ * the range of the tick timer. Returns the number of ticks programmed.
+ */
+extern FUNC(uint32, OS_CODE) Os_TicklessSleep
+(
+    CONST(uint32, AUTOMATIC) Ticks
+);
+
+/**
+ * @brief Port: ends the sleep and restores the periodic tick. Returns the whole ticks
+ * that passed, without the one counted by a pending tick interrupt.
+ */
+extern FUNC(uint32, OS_CODE) Os_TicklessWake
+(
+    void
+);
+
+/* Counter timer driver of Counters[0] (OS_COUNTER_COMPARE_TIMER, OS_TICK_DEFERRED), declared unconditionally */
+
+/**
+ * @brief Category 2 ISR of the compare interrupt of the timer of Counters[0], the
+ * deferred expiry handler with OS_TICK_DEFERRED.
+ */
+extern FUNC(void, OS_CODE) CounterTimer_Handler
+(
+    void
+);
+
+/**
+ * @brief Starts the timer of <Counter>, takes its value as the reference of the counter and
+ * arms the compare. Does nothing for a counter without timer.
+ */
+extern FUNC(void, OS_CODE) OS_CounterTimerInit
+(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter
+);
+
+/**
+ * @brief Adds the timer counts since the last update to <Counter>, the alarms due in
+ * between expire. Called with the kernel locked.
+ */
+extern FUNC(void, OS_CODE) OS_CounterTimerUpdate
+(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter
+);
+
+/**
+ * @brief Updates <Counter> and programs the compare for its next alarm expiry. Called
+ * with the kernel locked after the alarm queue of <Counter> changed.
+ */
+extern FUNC(void, OS_CODE) OS_CounterTimerProgram
+(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter
+);
+
+/**
+ * @brief Port: starts the free-running timer and enables its compare interrupt. With
+ * OS_TICK_DEFERRED the timer hooks are the SysTick count of Counters.c.
+ */
+extern FUNC(void, OS_CODE) Os_CounterTimerStart
+(
+    void
+);
+
+/**
+ * @brief Port: returns the value of the free-running timer, one count per counter tick.
+ * Also called by the tasks reading the time of Counters[0]: the timer is readable in user
+ * mode.
+ */
+extern FUNC(uint32, OS_CODE) Os_CounterTimerRead
+(
+    void
+);
+
+/**
+ * @brief Port: acknowledges the compare interrupt and raises the next one when the timer
+ * reaches <Compare>.
+ */
+extern FUNC(void, OS_CODE) Os_CounterTimerSetCompare
+(
+    CONST(uint32, AUTOMATIC) Compare
+);
+
+/**
+ * @brief Port: pends the deferred expiry handler CounterTimer_Handler (OS_TICK_DEFERRED),
+ * an interrupt below the priority of SysTick: it runs once SysTick has returned.
+ */
+extern FUNC(void, OS_CODE) Os_TickDeferredPend
+(
+    void
+);
 
 /***********************************************************************************/
 /*				    	 External Functions Definition		      				   */
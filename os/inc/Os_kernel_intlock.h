@@ -0,0 +1,194 @@
+/**
+ * @file Os_kernel_intlock.h
+ * @author Mahmoud Ismail
+ * @version 1.0.0
+ * @date 19-10-2026
+ * @platform
+ * @variant
+ * @vendor CryptOS
+ * @specification OSEK/VDX
+ * @brief Interrupt lock services (Disable/Enable, Suspend/Resume).
+ *
+ * The services are provided by the port as inline functions OS_xxxInterrupts(Site),
+ * they lock and unlock in the caller without entering the kernel:
+ *  - DisableAllInterrupts / EnableAllInterrupts : all interrupts, not nestable.
+ *  - SuspendAllInterrupts / ResumeAllInterrupts : all interrupts, nestable, the
+ *    outermost resume restores the state saved by the outermost suspend.
+ *  - SuspendOSInterrupts / ResumeOSInterrupts   : Category 2 ISRs only (kernel lock
+ *    level), nestable.
+ *
+ * With OS_INT_LOCK_MEASURE == STD_ON every call site gets a static Os_IntLockSiteType,
+ * the outermost lock and unlock measure the duration of the lock with OS_TIMESTAMP()
+ * of the port and the longest one is kept per call site in the list Os_IntLockSites.
+ */
+
+#if (!defined OS_KERNEL_INTLOCK_H)
+#define OS_KERNEL_INTLOCK_H
+
+/**********************************************************************************/
+/**				    			Include Headers			         				 **/
+/**********************************************************************************/
+
+/* Architecture selection (OS_ARCH) */
+#include <Os_Arch.h>
+#include <Os_Types.h>
+/* OS_INT_LOCK_MEASURE */
+#include <Os_Cfg.h>
+
+
+/***********************************************************************************/
+/*  			    			    Macros				         				   */
+/***********************************************************************************/
+
+/**
+ * @brief Records the longest lock duration per call site (debug mode).
+ */
+#if (!defined OS_INT_LOCK_MEASURE)
+#define OS_INT_LOCK_MEASURE						STD_OFF
+#endif /* #if (!defined OS_INT_LOCK_MEASURE) */
+
+#if (defined OS_INT_LOCK_ALL)
+#error OS_INT_LOCK_ALL already defined!
+#endif /*#if( defined OS_INT_LOCK_ALL)*/
+/* DisableAllInterrupts / EnableAllInterrupts */
+#define OS_INT_LOCK_ALL			(0x00U)
+
+#if (defined OS_INT_LOCK_SUSPEND_ALL)
+#error OS_INT_LOCK_SUSPEND_ALL already defined!
+#endif /*#if( defined OS_INT_LOCK_SUSPEND_ALL)*/
+/* SuspendAllInterrupts / ResumeAllInterrupts */
+#define OS_INT_LOCK_SUSPEND_ALL	(0x01U)
+
+#if (defined OS_INT_LOCK_SUSPEND_OS)
+#error OS_INT_LOCK_SUSPEND_OS already defined!
+#endif /*#if( defined OS_INT_LOCK_SUSPEND_OS)*/
+/* SuspendOSInterrupts / ResumeOSInterrupts */
+#define OS_INT_LOCK_SUSPEND_OS	(0x02U)
+
+/* Number of lock kinds */
+#define OS_INT_LOCK_KINDS		(0x03U)
+
+/**
+ * @brief Call site record of the calling lock service, NULL_PTR without the debug mode.
+ */
+#if (OS_INT_LOCK_MEASURE == STD_ON)
+#define OS_INT_LOCK_SITE()                                                      \
+	({                                                                          \
+		static Os_IntLockSiteType Os_IntLockSite = { __FILE__, __LINE__, 0U, 0U, NULL_PTR, FALSE }; \
+		&Os_IntLockSite;                                                        \
+	})
+#else
+#define OS_INT_LOCK_SITE()						(NULL_PTR)
+#endif /* #if (OS_INT_LOCK_MEASURE == STD_ON) */
+
+
+/***********************************************************************************/
+/*                                 TypeDefnitions                                  */
+/***********************************************************************************/
+
+typedef struct Os_IntLockSiteType_s Os_IntLockSiteType;
+
+/**
+ * @brief Lock duration statistics of one call site (debug mode).
+ */
+struct Os_IntLockSiteType_s
+{
+	/*! Source file and line of the lock call */
+	P2CONST(char, TYPEDEF, OS_CONST)			File;
+	VAR(uint32, TYPEDEF)						Line;
+	/*! Number of outermost locks taken at the site */
+	VAR(uint32, TYPEDEF)						Count;
+	/*! Longest lock in OS_TIMESTAMP() units of the port */
+	VAR(uint32, TYPEDEF)						MaxDuration;
+	/*! Next site of Os_IntLockSites */
+	P2VAR(Os_IntLockSiteType, TYPEDEF, OS_VAR)	Next;
+	/*! The site is linked in Os_IntLockSites */
+	VAR(boolean, TYPEDEF)						Registered;
+};
+
+
+/***********************************************************************************/
+/*				    	  External data	shared global varaibles	         	       */
+/***********************************************************************************/
+
+#if (OS_INT_LOCK_MEASURE == STD_ON)
+/*! Call sites that took a lock at least once */
+extern P2VAR(Os_IntLockSiteType, AUTOMATIC, OS_VAR) Os_IntLockSites;
+#endif /* #if (OS_INT_LOCK_MEASURE == STD_ON) */
+
+
+/***********************************************************************************/
+/*                        External Function Declration                             */
+/***********************************************************************************/
+
+/**
+ * @brief System call OS_SC_SuspendInterrupts, taken by an unprivileged task before its
+ * first lock <Kind> where the port needs privileges to lock the interrupts.
+ */
+extern FUNC(StatusType, OS_CODE) OS_SuspendInterrupts
+(
+	CONST(uint8, AUTOMATIC) Kind
+);
+
+#if (OS_INT_LOCK_MEASURE == STD_ON)
+/**
+ * @brief Starts the measurement of the outermost lock <Kind> taken at <Site>.
+ */
+extern FUNC(void, OS_CODE) OS_IntLockMeasureStart
+(
+	CONST(uint8, AUTOMATIC) Kind,
+	P2VAR(Os_IntLockSiteType, AUTOMATIC, OS_VAR) Site
+);
+
+/**
+ * @brief Ends the measurement of the lock <Kind>, called before the unlock.
+ */
+extern FUNC(void, OS_CODE) OS_IntLockMeasureStop
+(
+	CONST(uint8, AUTOMATIC) Kind
+);
+#endif /* #if (OS_INT_LOCK_MEASURE == STD_ON) */
+
+#if (OS_ARCH == OS_ARM)
+
+/* Inline lock services, included after the types they use */
+#include <Os_interrupts_cm4.h>
+
+#else
+
+extern FUNC(void, OS_CODE) OS_DisableAllInterrupts
+(
+	P2VAR(Os_IntLockSiteType, AUTOMATIC, OS_VAR) Site
+);
+
+extern FUNC(void, OS_CODE) OS_EnableAllInterrupts
+(
+	void
+);
+
+extern FUNC(void, OS_CODE) OS_SuspendAllInterrupts
+(
+	P2VAR(Os_IntLockSiteType, AUTOMATIC, OS_VAR) Site
+);
+
+extern FUNC(void, OS_CODE) OS_ResumeAllInterrupts
+(
+	void
+);
+
+extern FUNC(void, OS_CODE) OS_SuspendOSInterrupts
+(
+	P2VAR(Os_IntLockSiteType, AUTOMATIC, OS_VAR) Site
+);
+
+extern FUNC(void, OS_CODE) OS_ResumeOSInterrupts
+(
+	void
+);
+
+#endif /* #if (OS_ARCH == OS_ARM) */
+
+#endif /* #if (!defined OS_KERNEL_INTLOCK_H) */
+/***********************************************************************************/
+/*				    			 End Of File			         				   */
+/***********************************************************************************/
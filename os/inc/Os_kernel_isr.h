@@ -0,0 +1,122 @@
+/**
+ * @file Os_kernel_isr.h
+ * @author Mahmoud Ismail
+ * @version 1.0.0
+ * @date 19-10-2026
+ * @platform
+ * @variant
+ * @vendor CryptOS
+ * @specification OSEK/VDX
+ * @brief Category 2 interrupt service routines.
+ *
+ * A Category 2 ISR is written with the ISR(name) macro, the macro adds the entry and
+ * exit of the kernel around the body:
+ *  - entry: Kernel.IsrNestingLevel is incremented and the kernel state is OS_STATE_CAT2,
+ *    so the services called by the body (ActivateTask, SetEvent, ...) only mark
+ *    Kernel.SchedulerNeeded and never switch the context.
+ *  - exit : the outermost ISR restores the state of the interrupted task and, if any
+ *    nested ISR requested the scheduler, runs one single rescheduling (OS_ISR_DISPATCH).
+ *
+ * Category 1 ISRs are plain functions placed directly in the generated vector table,
+ * they shall not call any OS service.
+ */
+
+#if (!defined OS_KERNEL_ISR_H)
+#define OS_KERNEL_ISR_H
+
+/**********************************************************************************/
+/**				    			Include Headers			         				 **/
+/**********************************************************************************/
+
+#include <Os_Types.h>
+
+
+/***********************************************************************************/
+/*  			    			    Macros				         				   */
+/***********************************************************************************/
+
+#if (defined OS_ISR_CATEGORY_1) 
+#error OS_ISR_CATEGORY_1 already defined!
+#endif /*#if( defined OS_ISR_CATEGORY_1)*/
+/* ISR above the kernel lock level, not known to the kernel */
+#define OS_ISR_CATEGORY_1		(0x01U)
+
+#if (defined OS_ISR_CATEGORY_2) 
+#error OS_ISR_CATEGORY_2 already defined!
+#endif /*#if( defined OS_ISR_CATEGORY_2)*/
+/* ISR masked by the kernel lock, may call the OS services */
+#define OS_ISR_CATEGORY_2		(0x02U)
+
+#if (defined ISR)
+#error ISR already defined!
+#endif /*#if( defined ISR)*/
+/**
+ * @brief Defines the Category 2 ISR <Name>, the braces following the macro are the body.
+ *
+ * @code
+ * ISR(Can_RxHandler)
+ * {
+ *     (void)SetEvent(ComTask, EVENT_RX);
+ * }
+ * @endcode
+ */
+#define ISR(Name)                                                               \
+	static FUNC(void, OS_CODE) Os_IsrBody_##Name(void);                         \
+	FUNC(void, OS_CODE) Name(void)                                              \
+	{                                                                           \
+		OS_IsrEnter();                                                          \
+		Os_IsrBody_##Name();                                                    \
+		OS_IsrExit();                                                           \
+	}                                                                           \
+	static FUNC(void, OS_CODE) Os_IsrBody_##Name(void)
+
+
+/***********************************************************************************/
+/*                                 TypeDefnitions                                  */
+/***********************************************************************************/
+
+/*! Entry function of an interrupt vector */
+typedef P2FUNC(void, TYPEDEF, Os_IsrHandlerType)(void);
+
+typedef struct Os_Isr_s Os_Isr;
+
+/**
+ * @brief Generated configuration of an ISR.
+ */
+struct Os_Isr_s
+{
+	/*! Entry of the vector, the ISR() wrapper for a Category 2 ISR */
+	CONST(Os_IsrHandlerType, TYPEDEF)		IsrHandler;
+	/*! Interrupt request number of the interrupt controller */
+	CONST(uint16, TYPEDEF)					IsrIrqNumber;
+	/*! OS_ISR_CATEGORY_1 or OS_ISR_CATEGORY_2 */
+	CONST(uint8, TYPEDEF)					IsrCategory;
+	/*! Priority of the interrupt controller (0 is the most urgent) */
+	CONST(uint8, TYPEDEF)					IsrPriority;
+};
+
+
+/***********************************************************************************/
+/*                        External Function Declration                             */
+/***********************************************************************************/
+
+/**
+ * @brief Entry of a Category 2 ISR into the kernel.
+ */
+extern FUNC(void, OS_CODE) OS_IsrEnter
+(
+	void
+);
+
+/**
+ * @brief Exit of a Category 2 ISR, the outermost exit reschedules if it is needed.
+ */
+extern FUNC(void, OS_CODE) OS_IsrExit
+(
+	void
+);
+
+#endif /* #if (!defined OS_KERNEL_ISR_H) */
+/***********************************************************************************/
+/*				    			 End Of File			         				   */
+/***********************************************************************************/
@@ -0,0 +1,212 @@
+/**
+ * @file Os_kernel_schedtbl.h
+ * @author Mahmoud Ismail
+ * @version 1.0.0
+ * @date 19-10-2026
+ * @platform
+ * @variant
+ * @vendor CryptOS
+ * @specification AUTOSAR OS
+ * @brief Header file for the dataTypes of the schedule tables.
+ *
+ * A schedule table is a generated list of expiry points sorted by their offset from the
+ * start of the table, each one activating tasks and setting events. A running table
+ * keeps the counter value of its next expiry point (OsScheduleTableExpiryTime) and the
+ * index of that point (OsScheduleTableCursor): a tick costs one comparison per running
+ * table whatever the number of actions.
+ *
+ * A table with the explicit synchronisation strategy follows a time value supplied by
+ * SyncScheduleTable: the deviation of its position is corrected over the following
+ * expiry points, each delay to the next point being shortened or lengthened by at most
+ * the bounds of the point just processed.
+ */
+
+#if(!defined OS_KERNEL_SCHEDTBL_H)
+#define OS_KERNEL_SCHEDTBL_H
+
+/**********************************************************************************/
+/*                               INCLUDE HEADERS	                              */
+/**********************************************************************************/
+
+
+/***********************************************************************************/
+/*                                  MACROS                                         */
+/***********************************************************************************/
+
+/*! The schedule table is not started.*/
+#if (defined SCHEDULETABLE_STOPPED)
+#error SCHEDULETABLE_STOPPED already defined!
+#endif /*#if( defined SCHEDULETABLE_STOPPED)*/
+#define SCHEDULETABLE_STOPPED					(0x00U)
+
+/*! The schedule table starts at the end of the table it follows (NextScheduleTable).*/
+#if (defined SCHEDULETABLE_NEXT)
+#error SCHEDULETABLE_NEXT already defined!
+#endif /*#if( defined SCHEDULETABLE_NEXT)*/
+#define SCHEDULETABLE_NEXT						(0x01U)
+
+/*! The schedule table is running.*/
+#if (defined SCHEDULETABLE_RUNNING)
+#error SCHEDULETABLE_RUNNING already defined!
+#endif /*#if( defined SCHEDULETABLE_RUNNING)*/
+#define SCHEDULETABLE_RUNNING					(0x02U)
+
+/*! The schedule table waits for the first SyncScheduleTable (StartScheduleTableSynchron).*/
+#if (defined SCHEDULETABLE_WAITING)
+#error SCHEDULETABLE_WAITING already defined!
+#endif /*#if( defined SCHEDULETABLE_WAITING)*/
+#define SCHEDULETABLE_WAITING					(0x03U)
+
+/*! The schedule table is running, its deviation from the synchronisation value is within the precision.*/
+#if (defined SCHEDULETABLE_RUNNING_AND_SYNCHRONOUS)
+#error SCHEDULETABLE_RUNNING_AND_SYNCHRONOUS already defined!
+#endif /*#if( defined SCHEDULETABLE_RUNNING_AND_SYNCHRONOUS)*/
+#define SCHEDULETABLE_RUNNING_AND_SYNCHRONOUS	(0x04U)
+
+/*! The schedule table is not synchronised.*/
+#if (defined SCHEDULETABLE_SYNC_NONE)
+#error SCHEDULETABLE_SYNC_NONE already defined!
+#endif /*#if( defined SCHEDULETABLE_SYNC_NONE)*/
+#define SCHEDULETABLE_SYNC_NONE					(0x00U)
+
+/*! The schedule table is synchronised to the value supplied by SyncScheduleTable.*/
+#if (defined SCHEDULETABLE_SYNC_EXPLICIT)
+#error SCHEDULETABLE_SYNC_EXPLICIT already defined!
+#endif /*#if( defined SCHEDULETABLE_SYNC_EXPLICIT)*/
+#define SCHEDULETABLE_SYNC_EXPLICIT				(0x01U)
+
+
+/*************************************************************************************/
+/*                                 TypeDefnitions                                    */
+/*************************************************************************************/
+
+/* Os_ScheduleTable structure */
+typedef struct Os_ScheduleTable_s			Os_ScheduleTable;
+
+/**
+ * @brief Event set by an expiry point.
+ */
+typedef struct
+{
+	/*! Task owning the event */
+	CONST(TaskType, TYPEDEF)						OsScheduleTableEventTaskRef;
+
+	/*! Event mask set */
+	CONST(EventMaskType, TYPEDEF)					OsScheduleTableEventMask;
+} Os_ScheduleTableEvent;
+
+/**
+ * @brief Expiry point of a schedule table, the tasks are activated before the events are set.
+ */
+typedef struct
+{
+	/*! Ticks from the start of the table, the points of a table are sorted by offset */
+	CONST(TickType, TYPEDEF)						OsExpiryPointOffset;
+
+	/*! Tasks activated */
+	P2CONST(TaskType, TYPEDEF, OS_CONST)			OsExpiryPointTasks;
+
+	/*! Number of tasks activated */
+	CONST(uint8, TYPEDEF)							OsExpiryPointTaskCount;
+
+	/*! Events set */
+	P2CONST(Os_ScheduleTableEvent, TYPEDEF, OS_CONST) OsExpiryPointEvents;
+
+	/*! Number of events set */
+	CONST(uint8, TYPEDEF)							OsExpiryPointEventCount;
+
+	/*! Largest shortening of the delay to the next point (explicit synchronisation) */
+	CONST(TickType, TYPEDEF)						OsExpiryPointMaxShorten;
+
+	/*! Largest lengthening of the delay to the next point (explicit synchronisation) */
+	CONST(TickType, TYPEDEF)						OsExpiryPointMaxLengthen;
+} Os_ExpiryPoint;
+
+/**
+ * @brief Schedule table.
+ *
+ * Generation constraints: at least one expiry point, the offset of the last point below
+ * the duration and the duration at most OsCounterMaxAllowedValue of the counter. The
+ * OsExpiryPointMaxShorten of a point is below the delay to the next point (the final
+ * delay for the last one).
+ */
+struct Os_ScheduleTable_s
+{
+	/*! Expiry points sorted by offset */
+	P2CONST(Os_ExpiryPoint, TYPEDEF, OS_CONST)		OsScheduleTableExpiryPoints;
+
+	/*! Number of expiry points */
+	CONST(uint8, TYPEDEF)							OsScheduleTableExpiryPointCount;
+
+	/*! Length of a round of the table in ticks */
+	CONST(TickType, TYPEDEF)						OsScheduleTableDuration;
+
+	/*! TRUE: the table starts a new round at its end, FALSE: the table stops (single-shot) */
+	CONST(boolean, TYPEDEF)							OsScheduleTableRepeating;
+
+	/*! Reference to the counter driving the table */
+	P2VAR(Os_Counter, TYPEDEF, OS_CONST)			OsScheduleTableCounterRef;
+
+	/*! SCHEDULETABLE_SYNC_xxx strategy */
+	CONST(uint8, TYPEDEF)							OsScheduleTableSyncStrategy;
+
+	/*! Largest deviation in ticks of a table reported SCHEDULETABLE_RUNNING_AND_SYNCHRONOUS */
+	CONST(TickType, TYPEDEF)						OsScheduleTblExplicitPrecision;
+
+	/*! SCHEDULETABLE_xxx state */
+	VAR(uint8, TYPEDEF)								OsScheduleTableState;
+
+	/*! Next expiry point, OsScheduleTableExpiryPointCount for the end of the round */
+	VAR(uint8, TYPEDEF)								OsScheduleTableCursor;
+
+	/*! Counter value of the next expiry point (or of the end of the round) */
+	VAR(TickType, TYPEDEF)							OsScheduleTableExpiryTime;
+
+	/* Next running table of the counter */
+	P2VAR(Os_ScheduleTable, TYPEDEF, OS_VAR)		OsScheduleTableNext;
+
+	/* Table started at the end of this one (NextScheduleTable) */
+	P2VAR(Os_ScheduleTable, TYPEDEF, OS_VAR)		OsScheduleTableNextTable;
+
+	/*! Ticks the table is ahead (> 0) or behind (< 0) the synchronisation value, left to correct */
+	VAR(sint32, TYPEDEF)							OsScheduleTableDeviation;
+
+	/*! TRUE from SyncScheduleTable to SetScheduleTableAsync or the stop of the table */
+	VAR(boolean, TYPEDEF)							OsScheduleTableSynchronised;
+};
+
+
+/***********************************************************************************/
+/*                        External Function Declration                             */
+/***********************************************************************************/
+
+/**
+ * @brief Sets the schedule tables to SCHEDULETABLE_STOPPED, called by StartOS.
+ */
+extern FUNC(void, OS_CODE) OS_ScheduleTableInit
+(
+	void
+);
+
+/**
+ * @brief Processes the expiry points of the tables of <Counter> due at its current value,
+ * called on every tick of the counter with the kernel locked.
+ */
+extern FUNC(void, OS_CODE) OS_ScheduleTableTick
+(
+	P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter
+);
+
+/**
+ * @brief Ticks from the current value of <Counter> to the next expiry point of its
+ * running tables, 0 if no table is running.
+ */
+extern FUNC(TickType, OS_CODE) OS_ScheduleTableNextExpiry
+(
+	P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter
+);
+
+#endif /* #if(!defined OS_KERNEL_SCHEDTBL_H) */
+/***********************************************************************************/
+/*				    			 End Of File			         				   */
+/***********************************************************************************/
@@ -108,6 +108,12 @@
 /* OS in post task hook */
 #define OS_STATE_POSTTASKHOOK	(0x11U)
 
+#if (defined OS_MPU_TASK_REGIONS) 
+#error OS_MPU_TASK_REGIONS already defined!
+#endif /*#if( defined OS_MPU_TASK_REGIONS)*/
+/* Number of MPU regions reloaded on every context switch (stack, private data, shared data, spare) */
+#define OS_MPU_TASK_REGIONS		(0x04U)
+
 #define OS_CALL(typ, call) \
 	   ({ \
         typ result; \
@@ -156,6 +162,10 @@ typedef struct TaskFlagsType_s TaskFlagsType;
 
 typedef struct TaskStackType_s TaskStackType;
 
+typedef struct Os_MpuRegionType_s Os_MpuRegionType;
+
+typedef struct TaskMpuType_s TaskMpuType;
+
 typedef struct Os_TaskDynamic_s Os_TaskDynamic;
 
 typedef struct Os_Task_s Os_Task;
@@ -175,6 +185,10 @@ struct TaskFlagsType_s
 	VAR(uint8,TYPEDEF) Type            		 ;
 	/*! Task schedule mode (FULL_PREEMPTIVE_SCHEDULING,NON_PREEMPTIVE_SCHEDULING)*/
 	VAR(uint8,TYPEDEF) TaskSchedulingPolicy  ;
+	/*! Trusted task: runs privileged and calls the kernel directly (OS_MIXED_CALL) */
+	VAR(boolean,TYPEDEF) Trusted           ;
+	/*! The task may lock the interrupts while unprivileged (Cortex-M: OS_SC_SuspendInterrupts) */
+	VAR(boolean,TYPEDEF) InterruptLock     ;
 	
 };
 
@@ -197,6 +211,8 @@ struct Os_Task_s
 	P2VAR(TaskFlagsType,TYPEDEF,OS_CONST)						TaskFlags;
 	/*! Pointer to task's stack information */	 
 	P2VAR(TaskStackType,TYPEDEF,OS_CONST)	  					TaskStack; 
+	/*! Pointer to task's MPU regions, NULL_PTR if the task has no regions of its own */
+	P2CONST(TaskMpuType,TYPEDEF,OS_CONST)	  					TaskMpu; 
 	/*! Entry point of the stack which is pionter to a function */
 	CONST(EntryFunctionPtrType,TYPEDEF)	  						EntryPoint;
 	/*! constant pointer to internal resource */
@@ -251,6 +267,29 @@ struct TaskStackType_s
 	
 };
 
+/**
+ * @brief Structure contains one MPU region in the register format of the architecture.
+ */
+struct Os_MpuRegionType_s
+{
+	/*! Region base address register value (address, valid bit and region number) */
+	VAR(uint32,TYPEDEF)			  RegionBase;
+	/*! Region attribute and size register value, 0 disables the region */
+	VAR(uint32,TYPEDEF)			  RegionAttributes;
+};
+
+/**
+ * @brief Structure contains the MPU regions of a task (stack, private data, shared data).
+ *
+ * The regions are precomputed by the configuration, the context switch copies them
+ * to the MPU without any computation.
+ */
+struct TaskMpuType_s
+{
+	/*! Regions loaded when the task is dispatched */
+	VAR(Os_MpuRegionType,TYPEDEF)  Regions[OS_MPU_TASK_REGIONS];
+};
+
 /**
  * @brief Structure contains cunrrent kernel important data.
  */
@@ -274,6 +313,12 @@ struct Os_Kernel_s
 	VAR(boolean, TYPEDEF)					 DispatcherNeeded;
 	/*!  */
 	VAR(boolean, TYPEDEF)					 NewContext;
+	/*! Number of nested Category 2 ISRs, 0 at task level */
+	VAR(uint8, TYPEDEF)						 IsrNestingLevel;
+	/*! Os state of the task interrupted by the outermost Category 2 ISR */
+	VAR(OsStateType, TYPEDEF)				 IsrPreviousState;
+	/*! The dispatcher sleeps until a task is ready (OS_CONTEXTLESS_IDLE) */
+	VAR(boolean, TYPEDEF)					 IdleWaiting;
 	
 };
 
@@ -20,6 +20,10 @@
 /**				    			Include Headers			         				 **/
 /**********************************************************************************/
 
+/* Architecture selection (OS_ARCH) */
+#include <Os_Arch.h>
+
+#include <Os_Types.h>
 
 
 
@@ -27,10 +31,24 @@
 /*  			    			    Macros				         				   */
 /***********************************************************************************/
 
-#define OS_N_SYSCALL	21
+/**
+ * @brief Kernel entry of the API.
+ *
+ * OS_SYSTEM_CALL   : every task enters the kernel with the system call.
+ * OS_FUNCTION_CALL : every task is trusted and calls the kernel services directly.
+ * OS_MIXED_CALL    : tasks configured as trusted (TaskFlagsType.Trusted) run privileged
+ *                    and call the kernel directly, the other tasks use the system call.
+ */
+#if (!defined OS_SYSTEM_TYPE)
+#define OS_SYSTEM_TYPE	OS_SYSTEM_CALL
+#endif /* #if (!defined OS_SYSTEM_TYPE) */
+
+#define OS_N_SYSCALL	31
 
 
 #define OS_SC_InvalidSyscall				(0)
+/* Runs the scheduling requested by a trusted direct call */
+#define OS_SC_Dispatch						(OS_SC_InvalidSyscall)
 #define OS_SC_StartOs						(1)
 #define OS_SC_ActivateTask					(2)
 #define OS_SC_TerminateTask					(3)
@@ -52,42 +70,31 @@
 #define OS_SC_SuspendInterrupts				(19)
 #define OS_SC_ResumeInterrupts				(20)
 #define OS_SC_ShutdownOs					(21)
+#define OS_SC_RestartOs						(22)
+#define OS_SC_StartScheduleTableRel			(23)
+#define OS_SC_StartScheduleTableAbs			(24)
+#define OS_SC_StopScheduleTable				(25)
+#define OS_SC_NextScheduleTable				(26)
+#define OS_SC_GetScheduleTableStatus		(27)
+#define OS_SC_StartScheduleTableSynchron	(28)
+#define OS_SC_SyncScheduleTable				(29)
+#define OS_SC_SetScheduleTableAsync			(30)
 
 
-#define KERN_SC_INVALIDSYSCALL()				__asm("SVC 0x00")
-#define KERN_SC_STARTOS()								__asm("SVC 0x01")
-#define KERN_SC_ACTIVATETASK()					__asm("SVC 0x02")
-#define KERN_SC_TERMINATETASK()					__asm("SVC 0x03")
-#define KERN_SC_CHAINTASK()							__asm("SVC 0x04")
-#define KERN_SC_SCHEDULE()							__asm("SVC 0x05")
-#define KERN_SC_GETTASKID()							__asm("SVC 0x06")
-#define KERN_SC_GETTASKSTATE()					__asm("SVC 0x07")
-#define KERN_SC_GETRESOURCE()						__asm("SVC 0x08")
-#define KERN_SC_RELEASERESOURCE()				__asm("SVC 0x09")
-#define KERN_SC_SETEVENT()							__asm("SVC 0x0A")
-#define KERN_SC_CLEAREVENT()						__asm("SVC 0x0B")
-#define KERN_SC_GETEVENT()							__asm("SVC 0x0C")
-#define KERN_SC_WAITEVENT()							__asm("SVC 0x0D")
-#define KERN_SC_GETALARMBASE()					__asm("SVC 0x0E")
-#define KERN_SC_GETALARM()							__asm("SVC 0x0F")
-#define KERN_SC_SETRELALARM()						__asm("SVC 0x10")
-#define KERN_SC_SETABSALARM()						__asm("SVC 0x11")
-#define KERN_SC_CANCELALARM()						__asm("SVC 0x12")
-#define KERN_SC_SUSPENDINTERRUPTS()			__asm("SVC 0x13")
-#define KERN_SC_RESUMEINTERRUPTS()			__asm("SVC 0x14")
-#define KERN_SC_SHUTDOWNOS()						__asm("SVC 0x15")
-																	
-
 /************************************************************************************/
 /*				    	Internal Type Definitions		         			        */
 /************************************************************************************/
 
-
+/*! Generic entry of the system call table, cast to the service signature on dispatch */
+typedef void (*os_syscall_ptr)(void);
 
 /*************************************************************************************/
 /*                            External Global Variables                              */
 /*************************************************************************************/
 
+/*! System call table indexed by the OS_SC_xxx service numbers */
+extern const os_syscall_ptr OS_syscallTable[OS_N_SYSCALL];
+
 
 /***********************************************************************************/
 /*				    			External constants		         				   */
@@ -108,12 +115,29 @@
 /*                        External Function Declration                             */
 /***********************************************************************************/
 
+#if (OS_ARCH == OS_ARM)
+
+/* Inline entry stubs of the register based system call ABI */
+#include <Os_syscalls_cm4.h>
+
+#else
+
 extern FUNC(void, OS_CODE) SVC_StartOS
 ( 
     CONST(AppModeType, AUTOMATIC) Mode
 );
 
 
+extern FUNC(StatusType, OS_CODE) SVC_ShutdownOS
+(
+    CONST(StatusType, AUTOMATIC) Error
+);
+
+extern FUNC(StatusType, OS_CODE) SVC_RestartOS
+(
+    CONST(AppModeType, AUTOMATIC) Mode
+);
+
 extern FUNC(StatusType, OS_CODE) SVC_ActivateTask
 ( 
     CONST(TaskType, AUTOMATIC) TaskID 
@@ -212,6 +236,53 @@ extern FUNC(StatusType,OS_CODE) SVC_CancelAlarm
    CONST(AlarmType, AUTOMATIC) AlarmID
 );
 
+extern FUNC(StatusType,OS_CODE) SVC_StartScheduleTableRel
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID,
+    CONST(TickType, AUTOMATIC) Offset
+);
+
+extern FUNC(StatusType,OS_CODE) SVC_StartScheduleTableAbs
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID,
+    CONST(TickType, AUTOMATIC) Start
+);
+
+extern FUNC(StatusType,OS_CODE) SVC_StopScheduleTable
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID
+);
+
+extern FUNC(StatusType,OS_CODE) SVC_NextScheduleTable
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID_From,
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID_To
+);
+
+extern FUNC(StatusType,OS_CODE) SVC_GetScheduleTableStatus
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID,
+    ScheduleTableStatusRefType ScheduleStatus
+);
+
+extern FUNC(StatusType,OS_CODE) SVC_StartScheduleTableSynchron
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID
+);
+
+extern FUNC(StatusType,OS_CODE) SVC_SyncScheduleTable
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID,
+    CONST(TickType, AUTOMATIC) Value
+);
+
+extern FUNC(StatusType,OS_CODE) SVC_SetScheduleTableAsync
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID
+);
+
+#endif /* #if (OS_ARCH == OS_ARM) */
+
 /***********************************************************************************/
 /*				    	 External Functions Definition		      				   */
 /***********************************************************************************/
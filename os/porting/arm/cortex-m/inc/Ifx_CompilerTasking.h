@@ -129,6 +129,23 @@
 #define IFX_ENABLE_INTERRUPTS()               __asm("cpsie i");
 
 
+/**
+ * @brief Reads and writes the BASEPRI register.
+ *
+ * Interrupts with a priority value equal or higher than BASEPRI are masked, 0 masks
+ * nothing. IFX_SET_BASEPRI_MAX() only writes values that raise the masking level.
+ */
+#define IFX_GET_BASEPRI(value)                __asm volatile ("MRS %0,BASEPRI" : "=r" (value));
+#define IFX_SET_BASEPRI(value)                __asm volatile ("MSR BASEPRI,%0" :: "r" (value) : "memory");
+#define IFX_SET_BASEPRI_MAX(value)            __asm volatile ("MSR BASEPRI_MAX,%0" :: "r" (value) : "memory");
+
+
+
+/**
+ * @brief Places a constant in the section <name> with the alignment <align> (bytes).
+ */
+#define IFX_SECTION(name, align)              __attribute__((section(name), aligned(align)))
+
 
 /**
  * @brief Macro to move a value into a memory address using inline assembly.
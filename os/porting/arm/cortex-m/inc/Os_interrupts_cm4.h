@@ -0,0 +1,227 @@
+ /**
+ * @file Os_interrupts_cm4.h
+ * @author Mahmoud Ismail
+ * @version 1.0.0
+ * @date 19-10-2026
+ * @platform Aurix TC39x- HSM Core
+ * @brief Inline interrupt lock services of the Cortex-M port (Os_kernel_intlock.h).
+ *
+ * DisableAll / SuspendAll use PRIMASK, SuspendOS raises BASEPRI to OS_KERNEL_LOCK_LEVEL.
+ * The lock and unlock are a few instructions in the caller, no SVC is taken.
+ *
+ * PRIMASK and BASEPRI can only be written by privileged code, and an SVC cannot be taken
+ * while they mask the SVCall priority. An unprivileged task taking its first lock
+ * therefore issues OS_SC_SuspendInterrupts once: the task runs privileged until it
+ * releases its last lock, the unlock and the nested locks stay inline. The kernel only
+ * elevates a task configured with TaskFlagsType.InterruptLock, the elevation is recorded
+ * per task in Os_IntLockElevated.
+ *
+*/
+
+/*------------------------- MISRA-C vailoations in c files -----------------------*/
+#if(!defined OS_INTERRUPTS_CM4_H)
+#define OS_INTERRUPTS_CM4_H
+
+
+/**********************************************************************************/
+/*                               INCLUDE HEADERS	                              */
+/**********************************************************************************/
+
+#include <Os_kernel.h>
+/* Os_SvcCall1 and OS_SC_SuspendInterrupts */
+#include <Os_syscalls.h>
+
+
+/*************************************************************************************/
+/*                                 TypeDefnitions                                    */
+/*************************************************************************************/
+
+/**
+ * @brief State of the interrupt locks of the running task or ISR.
+ */
+typedef struct
+{
+	/*! PRIMASK saved by the outermost SuspendAllInterrupts */
+	VAR(uint32, TYPEDEF)		SuspendAllPrimask;
+	/*! BASEPRI saved by the outermost SuspendOSInterrupts */
+	VAR(uint32, TYPEDEF)		SuspendOsBasepri;
+	/*! Nesting counters of SuspendAll and SuspendOS */
+	VAR(uint8, TYPEDEF)			SuspendAllNesting;
+	VAR(uint8, TYPEDEF)			SuspendOsNesting;
+	/*! DisableAllInterrupts is active */
+	VAR(boolean, TYPEDEF)		DisableAll;
+} Os_IntLockType;
+
+
+/***********************************************************************************/
+/*				    	  External data	shared global varaibles	         	       */
+/***********************************************************************************/
+
+extern VAR(Os_IntLockType, OS_VAR) Os_IntLock;
+
+/* Tasks made privileged by OS_SC_SuspendInterrupts, indexed by the task ID */
+extern VAR(boolean, OS_VAR) Os_IntLockElevated[TASK_COUNT];
+
+
+/***********************************************************************************/
+/*				    	 External Functions Definition		      				   */
+/***********************************************************************************/
+
+/**
+ * @brief Makes an unprivileged task privileged before its first lock <Kind>.
+ */
+LOCAL_INLINE void Os_IntLockEnter(CONST(uint8, AUTOMATIC) Kind)
+{
+	uint32 Control;
+	uint32 Ipsr;
+
+	__asm volatile ("MRS %0, CONTROL \n\t MRS %1, IPSR" : "=r" (Control), "=r" (Ipsr));
+
+	/* In handler mode CONTROL.nPRIV is the one of the interrupted thread: only an
+	   unprivileged thread traps, an ISR is privileged */
+	if ((0UL == Ipsr) && (0UL != (Control & 0x01UL)))
+	{
+		(void)Os_SvcCall1(OS_SC_SuspendInterrupts, (uint32)Kind);
+	}
+}
+
+/**
+ * @brief Returns to unprivileged mode after the last unlock of an elevated task.
+ */
+LOCAL_INLINE void Os_IntLockLeave(void)
+{
+	uint32 Ipsr;
+
+	if ((FALSE == Os_IntLock.DisableAll) &&
+	    (0U == Os_IntLock.SuspendAllNesting) && (0U == Os_IntLock.SuspendOsNesting))
+	{
+		__asm volatile ("MRS %0, IPSR" : "=r" (Ipsr));
+
+		if ((0UL == Ipsr) && (NULL_PTR != Kernel.TaskRunning) &&
+		    (TRUE == Os_IntLockElevated[Kernel.TaskRunning->TaskID]))
+		{
+			Os_IntLockElevated[Kernel.TaskRunning->TaskID] = FALSE;
+			__asm volatile ("MRS R0, CONTROL \n\t ORR R0, R0, #0x01 \n\t MSR CONTROL, R0 \n\t ISB" ::: "r0", "memory");
+		}
+	}
+}
+
+LOCAL_INLINE void OS_DisableAllInterrupts(P2VAR(Os_IntLockSiteType, AUTOMATIC, OS_VAR) Site)
+{
+	Os_IntLockEnter(OS_INT_LOCK_ALL);
+	IFX_DISABLE_INTERRUPTS();
+	Os_IntLock.DisableAll = TRUE;
+
+#if (OS_INT_LOCK_MEASURE == STD_ON)
+	OS_IntLockMeasureStart(OS_INT_LOCK_ALL, Site);
+#else
+	(void)Site;
+#endif /* #if (OS_INT_LOCK_MEASURE == STD_ON) */
+}
+
+LOCAL_INLINE void OS_EnableAllInterrupts(void)
+{
+#if (OS_INT_LOCK_MEASURE == STD_ON)
+	OS_IntLockMeasureStop(OS_INT_LOCK_ALL);
+#endif /* #if (OS_INT_LOCK_MEASURE == STD_ON) */
+
+	Os_IntLock.DisableAll = FALSE;
+	Os_IntLockLeave();
+	IFX_ENABLE_INTERRUPTS();
+}
+
+LOCAL_INLINE void OS_SuspendAllInterrupts(P2VAR(Os_IntLockSiteType, AUTOMATIC, OS_VAR) Site)
+{
+	uint32 Primask;
+
+	if (0U == Os_IntLock.SuspendAllNesting)
+	{
+		Os_IntLockEnter(OS_INT_LOCK_SUSPEND_ALL);
+	}
+
+	__asm volatile ("MRS %0, PRIMASK \n\t CPSID I" : "=r" (Primask) :: "memory");
+
+	if (0U == Os_IntLock.SuspendAllNesting)
+	{
+		Os_IntLock.SuspendAllPrimask = Primask;
+
+#if (OS_INT_LOCK_MEASURE == STD_ON)
+		OS_IntLockMeasureStart(OS_INT_LOCK_SUSPEND_ALL, Site);
+#endif /* #if (OS_INT_LOCK_MEASURE == STD_ON) */
+	}
+#if (OS_INT_LOCK_MEASURE == STD_OFF)
+	(void)Site;
+#endif /* #if (OS_INT_LOCK_MEASURE == STD_OFF) */
+
+	Os_IntLock.SuspendAllNesting++;
+}
+
+LOCAL_INLINE void OS_ResumeAllInterrupts(void)
+{
+	/* A resume without suspend is ignored */
+	if (0U != Os_IntLock.SuspendAllNesting)
+	{
+		Os_IntLock.SuspendAllNesting--;
+
+		if (0U == Os_IntLock.SuspendAllNesting)
+		{
+#if (OS_INT_LOCK_MEASURE == STD_ON)
+			OS_IntLockMeasureStop(OS_INT_LOCK_SUSPEND_ALL);
+#endif /* #if (OS_INT_LOCK_MEASURE == STD_ON) */
+
+			Os_IntLockLeave();
+			__asm volatile ("MSR PRIMASK, %0" :: "r" (Os_IntLock.SuspendAllPrimask) : "memory");
+		}
+	}
+}
+
+LOCAL_INLINE void OS_SuspendOSInterrupts(P2VAR(Os_IntLockSiteType, AUTOMATIC, OS_VAR) Site)
+{
+	uint32 Basepri;
+
+	if (0U == Os_IntLock.SuspendOsNesting)
+	{
+		Os_IntLockEnter(OS_INT_LOCK_SUSPEND_OS);
+	}
+
+	IFX_GET_BASEPRI(Basepri);
+	OS_KERNEL_LOCK();
+
+	if (0U == Os_IntLock.SuspendOsNesting)
+	{
+		Os_IntLock.SuspendOsBasepri = Basepri;
+
+#if (OS_INT_LOCK_MEASURE == STD_ON)
+		OS_IntLockMeasureStart(OS_INT_LOCK_SUSPEND_OS, Site);
+#endif /* #if (OS_INT_LOCK_MEASURE == STD_ON) */
+	}
+#if (OS_INT_LOCK_MEASURE == STD_OFF)
+	(void)Site;
+#endif /* #if (OS_INT_LOCK_MEASURE == STD_OFF) */
+
+	Os_IntLock.SuspendOsNesting++;
+}
+
+LOCAL_INLINE void OS_ResumeOSInterrupts(void)
+{
+	/* A resume without suspend is ignored */
+	if (0U != Os_IntLock.SuspendOsNesting)
+	{
+		Os_IntLock.SuspendOsNesting--;
+
+		if (0U == Os_IntLock.SuspendOsNesting)
+		{
+#if (OS_INT_LOCK_MEASURE == STD_ON)
+			OS_IntLockMeasureStop(OS_INT_LOCK_SUSPEND_OS);
+#endif /* #if (OS_INT_LOCK_MEASURE == STD_ON) */
+
+			Os_IntLockLeave();
+			IFX_SET_BASEPRI(Os_IntLock.SuspendOsBasepri);
+		}
+	}
+}
+
+#endif /* #if(!defined OS_INTERRUPTS_CM4_H) */
+/***********************************************************************************/
+/*				    			 End Of File			         				   */
+/***********************************************************************************/
@@ -53,6 +53,181 @@
  * and allow the operating system to schedule the next task to run.
  */
 #define OS_DISPATCH()                              SET_PENDSV()                       
+
+/**
+ * @brief Rescheduling at the exit of the outermost Category 2 ISR.
+ *
+ * PendSV runs at the lowest priority, it is tail-chained once all the active ISRs
+ * have returned and schedules and switches like the end of SVC_Handler.
+ */
+#define OS_ISR_DISPATCH()                          SET_PENDSV()
+
+/**
+ * @brief System handler priority registers, SVCall is in SHPR2[31:24], PendSV and
+ * SysTick in SHPR3[23:16] and SHPR3[31:24].
+ */
+#define SCB_SHPR2                                   0xE000ED1CUL
+#define SCB_SHPR3                                   0xE000ED20UL
+
+#define SCB_SHPR2_REG                               (*(volatile unsigned int*)(SCB_SHPR2))
+#define SCB_SHPR3_REG                               (*(volatile unsigned int*)(SCB_SHPR3))
+
+/**
+ * @brief Vector table offset register and NVIC registers of the interrupt <Irq>.
+ */
+#define SCB_VTOR                                    0xE000ED08UL
+#define NVIC_ISER                                   0xE000E100UL
+#define NVIC_ISPR                                   0xE000E200UL
+#define NVIC_IPR                                    0xE000E400UL
+
+#define SCB_VTOR_REG                                (*(volatile unsigned int*)(SCB_VTOR))
+#define NVIC_ISER_REG(Irq)                          (*(volatile unsigned int*)(NVIC_ISER + (4UL * ((uint32)(Irq) >> 5))))
+#define NVIC_ISPR_REG(Irq)                          (*(volatile unsigned int*)(NVIC_ISPR + (4UL * ((uint32)(Irq) >> 5))))
+#define NVIC_IPR_REG(Irq)                           (*(volatile unsigned char*)(NVIC_IPR + (uint32)(Irq)))
+
+/* Number of Cortex-M system exception entries in front of the external interrupts */
+#define OS_CORE_VECTOR_COUNT                        (16U)
+
+/**
+ * @brief Converts a NVIC priority (0..2^OS_NVIC_PRIO_BITS-1) into the 8-bit register value.
+ */
+#define OS_NVIC_PRIORITY(Priority)                  ((uint32)(Priority) << (8U - OS_NVIC_PRIO_BITS))
+
+/**
+ * @brief BASEPRI value of the kernel lock.
+ *
+ * The kernel masks the Category 2 ISRs (and SysTick, SVCall and PendSV that run below
+ * them) but never the Category 1 ISRs, they keep their latency while a service runs.
+ */
+#define OS_KERNEL_LOCK_LEVEL                        OS_NVIC_PRIORITY(OS_CAT2_ISR_HIGHEST_PRIORITY)
+
+/**
+ * @brief Priority of the kernel exceptions SVCall, PendSV and SysTick: the lowest one.
+ */
+#define OS_KERNEL_EXCEPTION_PRIORITY                OS_NVIC_PRIORITY((1UL << OS_NVIC_PRIO_BITS) - 1UL)
+
+/**
+ * @brief Priority of SysTick with OS_CONTEXTLESS_IDLE: one level above SVCall and PendSV,
+ * the tick must preempt the dispatcher sleeping in idle.
+ */
+#define OS_IDLE_TICK_PRIORITY                       OS_NVIC_PRIORITY((1UL << OS_NVIC_PRIO_BITS) - 2UL)
+
+/**
+ * @brief Priority of SysTick with OS_TICK_DEFERRED and OS_CONTEXTLESS_IDLE: one level above
+ * the deferred expiry handler, that runs at OS_IDLE_TICK_PRIORITY. Without
+ * OS_CONTEXTLESS_IDLE, SysTick runs at OS_IDLE_TICK_PRIORITY and the handler at
+ * OS_KERNEL_EXCEPTION_PRIORITY: no tick is delayed by the expiries.
+ */
+#define OS_DEFERRED_TICK_PRIORITY                   OS_NVIC_PRIORITY((1UL << OS_NVIC_PRIO_BITS) - 3UL)
+
+/**
+ * @brief Locks and unlocks the kernel data against the Category 2 ISRs.
+ */
+#define OS_KERNEL_LOCK()                            IFX_SET_BASEPRI_MAX(OS_KERNEL_LOCK_LEVEL)
+#define OS_KERNEL_UNLOCK()                          IFX_SET_BASEPRI(0UL)
+
+/**
+ * @brief Data Watchpoint and Trace cycle counter, used for the kernel timing measurements.
+ */
+#define DEMCR                                       0xE000EDFCUL
+#define DWT_CTRL                                    0xE0001000UL
+#define DWT_CYCCNT                                  0xE0001004UL
+
+#define DEMCR_REG                                   (*(volatile unsigned int*)(DEMCR))
+#define DWT_CTRL_REG                                (*(volatile unsigned int*)(DWT_CTRL))
+#define DWT_CYCCNT_REG                              (*(volatile unsigned int*)(DWT_CYCCNT))
+
+#define DEMCR_TRCENA                                (1UL << 24)
+#define DWT_CTRL_CYCCNTENA                          (1UL << 0)
+
+/**
+ * @brief SysTick timer registers, reprogrammed by the tickless idle.
+ */
+#define SYST_CSR                                    0xE000E010UL
+#define SYST_RVR                                    0xE000E014UL
+#define SYST_CVR                                    0xE000E018UL
+
+#define SYST_CSR_REG                                (*(volatile unsigned int*)(SYST_CSR))
+#define SYST_RVR_REG                                (*(volatile unsigned int*)(SYST_RVR))
+#define SYST_CVR_REG                                (*(volatile unsigned int*)(SYST_CVR))
+
+#define SYST_CSR_ENABLE                             (1UL << 0)
+#define SYST_CSR_COUNTFLAG                          (1UL << 16)
+#define SYST_RVR_MAX                                (0x00FFFFFFUL)
+
+/**
+ * @brief End of ShutdownOS: all interrupts disabled, endless loop.
+ */
+#define OS_SHUTDOWN_HALT()                          do { IFX_DISABLE_INTERRUPTS(); for (;;) {} } while (0)
+
+/**
+ * @brief Time stamp of the lock measurements: CPU cycles.
+ */
+#define OS_TIMESTAMP()                              (DWT_CYCCNT_REG)
+
+/**
+ * @brief Orders the accesses to the counter time snapshots around their generation, a
+ * compiler barrier is enough on the single core.
+ */
+#define OS_MEMORY_BARRIER()                         __asm volatile ("" ::: "memory")
+
+/**
+ * @brief Section of the counter time snapshots, mapped read-only for the tasks by a static
+ * MPU region (OS_MPU_PROTECTION): the linker places it at the base of that region.
+ */
+#define OS_COUNTER_TIME_SECTION                     IFX_SECTION(".os_counter_time", 32)
+
+/**
+ * @brief ARMv7-M MPU registers.
+ *
+ * MPU_RBAR_A1..A3 / MPU_RASR_A1..A3 are aliases of MPU_RBAR / MPU_RASR that follow them
+ * in memory, so with the VALID bit set in every RBAR value the four task regions are
+ * written by one block store of 8 words starting at MPU_RBAR.
+ */
+#define MPU_CTRL                                    0xE000ED94UL
+#define MPU_RNR                                     0xE000ED98UL
+#define MPU_RBAR                                    0xE000ED9CUL
+
+/* MPU_CTRL bits: enable, keep the MPU in HardFault/NMI, default map for privileged code */
+#define MPU_CTRL_ENABLE                             (0x01UL)
+#define MPU_CTRL_HFNMIENA                           (0x02UL)
+#define MPU_CTRL_PRIVDEFENA                         (0x04UL)
+
+/* Regions 0..3 are static, the regions of the running task use 4..7 (higher number wins) */
+#define OS_MPU_STATIC_REGIONS                       (0x04U)
+#define OS_MPU_TASK_REGION(Index)                   (OS_MPU_STATIC_REGIONS + (Index))
+
+/* Access permissions (RASR.AP) */
+#define OS_MPU_AP_PRIV_ONLY                         (0x01UL)
+#define OS_MPU_AP_USER_RO                           (0x02UL)
+#define OS_MPU_AP_FULL                              (0x03UL)
+#define OS_MPU_AP_RO                                (0x06UL)
+
+/* Memory attributes (RASR.TEX/S/C/B) */
+#define OS_MPU_ATTR_FLASH                           (0x00020000UL)	/* Normal, write-through */
+#define OS_MPU_ATTR_SRAM                            (0x00060000UL)	/* Normal, write-through, shareable */
+#define OS_MPU_ATTR_DEVICE                          (0x00050000UL)	/* Device, shareable */
+
+/* Execute never */
+#define OS_MPU_XN                                   (0x10000000UL)
+#define OS_MPU_EXEC                                 (0x00000000UL)
+
+/**
+ * @brief MPU_RBAR value of a region: base address, VALID bit and region number.
+ */
+#define OS_MPU_RBAR(Base, Region)                   (((uint32)(Base) & 0xFFFFFFE0UL) | 0x10UL | ((uint32)(Region) & 0x0FUL))
+
+/**
+ * @brief MPU_RASR value of an enabled region of 2^SizeLog2 bytes (SizeLog2 = 5..32).
+ *
+ * The base address of the region must be aligned on its size.
+ */
+#define OS_MPU_RASR(SizeLog2, Ap, Xn, Attr)         ((uint32)(Xn) | ((uint32)(Ap) << 24) | (uint32)(Attr) | ((((uint32)(SizeLog2)) - 1UL) << 1) | 0x01UL)
+
+/**
+ * @brief Initializer of a disabled region, still addressed to its region number.
+ */
+#define OS_MPU_REGION_DISABLED(Region)              { OS_MPU_RBAR(0UL, (Region)), 0UL }
                                                          
 
 
@@ -68,6 +243,23 @@
  */
 #define OS_Idle()	OS_CoretexIdle()
 
+/**
+ * @brief Sleep of the dispatcher waiting in idle (OS_CONTEXTLESS_IDLE), kernel locked.
+ *
+ * PRIMASK closes the window between the unlock and the WFI: an interrupt pending in
+ * between still wakes the core up and is taken after CPSIE I, before the lock again.
+ */
+#define OS_IDLE_WAIT()                                                              \
+	do                                                                              \
+	{                                                                               \
+		IFX_DISABLE_INTERRUPTS();                                                   \
+		OS_KERNEL_UNLOCK();                                                         \
+		__asm volatile ("dsb \n\t wfi" ::: "memory");                              \
+		IFX_ENABLE_INTERRUPTS();                                                    \
+		__asm volatile ("isb" ::: "memory");                                        \
+		OS_KERNEL_LOCK();                                                           \
+	} while (0)
+
 
 
 /*************************************************************************************/
@@ -89,6 +281,9 @@ typedef  struct
 	int x ;
 }Os_ContexType;
 
+/*! Entry of the vector table (entry 0 holds the initial stack pointer) */
+typedef void (*Os_VectorType)(void);
+
 /***********************************************************************************/
 /*                        External Function Declration                             */
 /***********************************************************************************/
@@ -132,11 +327,39 @@ void OS_ResumeTask(void *PrevTas);
  */
 void OS_CoretexIdle(void);
 
+/**
+ * @brief Installs the generated vector table (VTOR), sets the NVIC priority of every
+ * configured ISR and enables it.
+ *
+ * Called by SVC_StartOS in privileged thread mode before the first system call.
+ */
+void Os_InitInterrupts(void);
+
+/**
+ * @brief Entry of the vectors without configured handler, stops in an endless loop.
+ */
+void Os_UnhandledInterrupt(void);
+
+/**
+ * @brief Sets the priority of the kernel exceptions below the Category 2 ISRs.
+ *
+ * Called by SVC_StartOS in privileged thread mode before the first system call.
+ */
+void Os_InitKernelLock(void);
+
 
 void OS_EnterKernel(void);
 
 void OS_LeaveKernel(void);
 
+/**
+ * @brief Programs the static MPU regions and enables the MPU.
+ *
+ * Privileged code keeps the default memory map, the tasks run unprivileged and only
+ * access the static regions and the regions of their own TaskMpuType.
+ */
+void Os_MpuInit(void);
+
 /***********************************************************************************/
 /*				    	 External Functions Definition		      				   */
 /***********************************************************************************/
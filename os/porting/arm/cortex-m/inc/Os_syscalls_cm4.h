@@ -0,0 +1,246 @@
+ /**
+ * @file Os_syscalls_cm4.h
+ * @author Mahmoud Ismail
+ * @version 1.0.0
+ * @date 19-10-2026
+ * @platform Aurix TC39x- HSM Core
+ * @brief System call entry stubs of the Cortex-M port.
+ *
+ * System call ABI:
+ *  - R0..R2 : arguments of the service (in declaration order)
+ *  - R3     : service number (OS_SC_xxx)
+ *  - SVC #0 : the immediate of the SVC instruction is ignored
+ *  - R0     : return value (StatusType), written back into the exception frame
+ *
+ * SVC_Handler reads R0..R3 from the exception frame of the PSP with one LDM (the
+ * registers themselves are not valid after a tail-chained exception) and indexes the
+ * system call table with R3. It never reads the SVC instruction from the code memory.
+ * The stubs below are inlined into the caller, the arguments are placed directly in
+ * R0..R3 and no call or return value copy is needed around the SVC.
+ *
+ * Trusted direct call (OS_SYSTEM_TYPE == OS_FUNCTION_CALL / OS_MIXED_CALL):
+ * a caller running privileged (trusted task) or in handler mode calls the OS_xxx
+ * service directly under the kernel lock (BASEPRI) instead of taking the SVC.
+ * Os_TrustedLeave() then checks Kernel.SchedulerNeeded like SVC_Handler does and,
+ * from a task, issues OS_SC_Dispatch so the scheduling and the context switch still
+ * run in SVC_Handler.
+ *
+ * Category 2 ISRs always use the direct call in every OS_SYSTEM_TYPE: an SVC cannot be
+ * taken from an ISR running above the SVCall priority. The rescheduling is then left
+ * to the exit of the outermost ISR (Os_kernel_isr.h).
+ *
+*/
+
+/*------------------------- MISRA-C vailoations in c files -----------------------*/
+#if(!defined OS_SYSCALLS_CM4_H)
+#define OS_SYSCALLS_CM4_H
+
+
+/**********************************************************************************/
+/*                               INCLUDE HEADERS	                              */
+/**********************************************************************************/
+
+#include <Os_Types.h>
+
+/* Kernel services and kernel lock used by the direct calls */
+#include <Os_kernel.h>
+
+
+/***********************************************************************************/
+/*                                  MACROS                                         */
+/***********************************************************************************/
+
+/**
+ * @brief Issues the system call <Service> without arguments, from code that cannot use
+ * the inline stubs (e.g. after the stack switch of SVC_StartOS).
+ */
+#define OS_SVC_TRAP(Service)                       __asm volatile ("MOVS R3, %0 \n\t SVC #0" :: "i" (Service) : "r3", "memory")
+
+/**
+ * @brief Calls the kernel service directly and returns from the stub if the caller is
+ * trusted, falls through to the system call otherwise.
+ */
+#define OS_TRUSTED_CALL(Call)                                                       \
+	if (TRUE == Os_CallerTrusted())                                                 \
+	{                                                                               \
+		VAR(uint32, AUTOMATIC) Lock = Os_TrustedEnter();                            \
+		VAR(StatusType, AUTOMATIC) Status = (Call);                                 \
+		Os_TrustedLeave(Lock);                                                      \
+		return Status;                                                              \
+	}
+
+/**
+ * @brief Generate the inline entry stub <Name> of the service <Service> (<Kernel> for
+ * the trusted direct call).
+ */
+#define OS_SVC_STUB0(Name, Service, Kernel)                                         \
+	LOCAL_INLINE FUNC(StatusType, OS_CODE) Name(void)                               \
+	{                                                                               \
+		OS_TRUSTED_CALL(Kernel())                                                   \
+		return (StatusType)Os_SvcCall0((Service));                                  \
+	}
+
+#define OS_SVC_STUB1(Name, Service, Kernel, Type0)                                  \
+	LOCAL_INLINE FUNC(StatusType, OS_CODE) Name(CONST(Type0, AUTOMATIC) Arg0)      \
+	{                                                                               \
+		OS_TRUSTED_CALL(Kernel(Arg0))                                               \
+		return (StatusType)Os_SvcCall1((Service), (uint32)Arg0);                    \
+	}
+
+#define OS_SVC_STUB2(Name, Service, Kernel, Type0, Type1)                           \
+	LOCAL_INLINE FUNC(StatusType, OS_CODE) Name(CONST(Type0, AUTOMATIC) Arg0,      \
+	                                            CONST(Type1, AUTOMATIC) Arg1)      \
+	{                                                                               \
+		OS_TRUSTED_CALL(Kernel(Arg0, Arg1))                                         \
+		return (StatusType)Os_SvcCall2((Service), (uint32)Arg0, (uint32)Arg1);      \
+	}
+
+#define OS_SVC_STUB3(Name, Service, Kernel, Type0, Type1, Type2)                    \
+	LOCAL_INLINE FUNC(StatusType, OS_CODE) Name(CONST(Type0, AUTOMATIC) Arg0,      \
+	                                            CONST(Type1, AUTOMATIC) Arg1,      \
+	                                            CONST(Type2, AUTOMATIC) Arg2)      \
+	{                                                                               \
+		OS_TRUSTED_CALL(Kernel(Arg0, Arg1, Arg2))                                   \
+		return (StatusType)Os_SvcCall3((Service), (uint32)Arg0, (uint32)Arg1, (uint32)Arg2); \
+	}
+
+
+/***********************************************************************************/
+/*				    	 External Functions Definition		      				   */
+/***********************************************************************************/
+
+/**
+ * @brief Generic system calls with 0 to 3 arguments, the values are bound to R0..R3.
+ */
+LOCAL_INLINE uint32 Os_SvcCall0(const uint32 Service)
+{
+	register uint32 R0 __asm("r0");
+	register uint32 R3 __asm("r3") = Service;
+
+	__asm volatile ("SVC #0" : "=r" (R0) : "r" (R3) : "memory");
+
+	return R0;
+}
+
+LOCAL_INLINE uint32 Os_SvcCall1(const uint32 Service, const uint32 Arg0)
+{
+	register uint32 R0 __asm("r0") = Arg0;
+	register uint32 R3 __asm("r3") = Service;
+
+	__asm volatile ("SVC #0" : "+r" (R0) : "r" (R3) : "memory");
+
+	return R0;
+}
+
+LOCAL_INLINE uint32 Os_SvcCall2(const uint32 Service, const uint32 Arg0, const uint32 Arg1)
+{
+	register uint32 R0 __asm("r0") = Arg0;
+	register uint32 R1 __asm("r1") = Arg1;
+	register uint32 R3 __asm("r3") = Service;
+
+	__asm volatile ("SVC #0" : "+r" (R0) : "r" (R1), "r" (R3) : "memory");
+
+	return R0;
+}
+
+LOCAL_INLINE uint32 Os_SvcCall3(const uint32 Service, const uint32 Arg0, const uint32 Arg1, const uint32 Arg2)
+{
+	register uint32 R0 __asm("r0") = Arg0;
+	register uint32 R1 __asm("r1") = Arg1;
+	register uint32 R2 __asm("r2") = Arg2;
+	register uint32 R3 __asm("r3") = Service;
+
+	__asm volatile ("SVC #0" : "+r" (R0) : "r" (R1), "r" (R2), "r" (R3) : "memory");
+
+	return R0;
+}
+
+/**
+ * @brief Leaves the interrupt lock of a trusted direct call and enters SVC_Handler
+ * with OS_SC_Dispatch if the service requested the scheduler.
+ */
+extern void Os_TrustedLeave(uint32 Lock);
+
+/**
+ * @brief TRUE if the caller may call the kernel directly: an interrupt handler or, with
+ * OS_MIXED_CALL, a privileged (trusted) task.
+ */
+LOCAL_INLINE boolean Os_CallerTrusted(void)
+{
+#if (OS_SYSTEM_TYPE == OS_FUNCTION_CALL)
+	return TRUE;
+#elif (OS_SYSTEM_TYPE == OS_MIXED_CALL)
+	uint32 Control;
+	uint32 Ipsr;
+
+	__asm volatile ("MRS %0, CONTROL \n\t MRS %1, IPSR" : "=r" (Control), "=r" (Ipsr));
+
+	return ((0UL == (Control & 0x01UL)) || (0UL != Ipsr)) ? TRUE : FALSE;
+#else
+	uint32 Ipsr;
+
+	__asm volatile ("MRS %0, IPSR" : "=r" (Ipsr));
+
+	return (0UL != Ipsr) ? TRUE : FALSE;
+#endif /* #if (OS_SYSTEM_TYPE == OS_FUNCTION_CALL) */
+}
+
+/**
+ * @brief Kernel lock of a trusted direct call, returns the previous BASEPRI.
+ */
+LOCAL_INLINE uint32 Os_TrustedEnter(void)
+{
+	uint32 Basepri;
+
+	IFX_GET_BASEPRI(Basepri);
+	OS_KERNEL_LOCK();
+
+	return Basepri;
+}
+
+/************************** Service entry stubs ************************************/
+
+OS_SVC_STUB1(SVC_ActivateTask,    OS_SC_ActivateTask,    OS_ActivateTask,    TaskType)
+OS_SVC_STUB0(SVC_TerminateTask,   OS_SC_TerminateTask,   OS_TerminateTask)
+OS_SVC_STUB1(SVC_ChainTask,       OS_SC_ChainTask,       OS_ChainTask,       TaskType)
+OS_SVC_STUB0(SVC_Schedule,        OS_SC_Schedule,        OS_Schedule)
+OS_SVC_STUB1(SVC_GetTaskID,       OS_SC_GetTaskID,       OS_GetTaskID,       TaskRefType)
+OS_SVC_STUB2(SVC_GetTaskState,    OS_SC_GetTaskState,    OS_GetTaskState,    TaskType, TaskStateRefType)
+OS_SVC_STUB1(SVC_GetResource,     OS_SC_GetResource,     OS_GetResource,     ResourceType)
+OS_SVC_STUB1(SVC_ReleaseResource, OS_SC_ReleaseResource, OS_ReleaseResource, ResourceType)
+OS_SVC_STUB2(SVC_SetEvent,        OS_SC_SetEvent,        OS_SetEvent,        TaskType, EventMaskType)
+OS_SVC_STUB1(SVC_WaitEvent,       OS_SC_WaitEvent,       OS_WaitEvent,       EventMaskType)
+OS_SVC_STUB2(SVC_GetEvent,        OS_SC_GetEvent,        OS_GetEvent,        TaskType, EventMaskRefType)
+OS_SVC_STUB1(SVC_ClearEvent,      OS_SC_ClearEvent,      OS_ClearEvent,      EventMaskType)
+OS_SVC_STUB2(SVC_GetAlarmBase,    OS_SC_GetAlarmBase,    OS_GetAlarmBase,    AlarmType, AlarmBaseRefType)
+OS_SVC_STUB2(SVC_GetAlarm,        OS_SC_GetAlarm,        OS_GetAlarm,        AlarmType, TickRefType)
+OS_SVC_STUB3(SVC_SetRelAlarm,     OS_SC_SetRelAlarm,     OS_SetRelAlarm,     AlarmType, TickType, TickType)
+OS_SVC_STUB3(SVC_SetAbsAlarm,     OS_SC_SetAbsAlarm,     OS_SetAbsAlarm,     AlarmType, TickType, TickType)
+OS_SVC_STUB1(SVC_CancelAlarm,     OS_SC_CancelAlarm,     OS_CancelAlarm,     AlarmType)
+OS_SVC_STUB1(SVC_ShutdownOS,      OS_SC_ShutdownOs,      OS_ShutdownOS,      StatusType)
+OS_SVC_STUB1(SVC_RestartOS,       OS_SC_RestartOs,       OS_RestartOS,       AppModeType)
+OS_SVC_STUB2(SVC_StartScheduleTableRel,  OS_SC_StartScheduleTableRel,  OS_StartScheduleTableRel,  ScheduleTableType, TickType)
+OS_SVC_STUB2(SVC_StartScheduleTableAbs,  OS_SC_StartScheduleTableAbs,  OS_StartScheduleTableAbs,  ScheduleTableType, TickType)
+OS_SVC_STUB1(SVC_StopScheduleTable,      OS_SC_StopScheduleTable,      OS_StopScheduleTable,      ScheduleTableType)
+OS_SVC_STUB2(SVC_NextScheduleTable,      OS_SC_NextScheduleTable,      OS_NextScheduleTable,      ScheduleTableType, ScheduleTableType)
+OS_SVC_STUB2(SVC_GetScheduleTableStatus, OS_SC_GetScheduleTableStatus, OS_GetScheduleTableStatus, ScheduleTableType, ScheduleTableStatusRefType)
+OS_SVC_STUB1(SVC_StartScheduleTableSynchron, OS_SC_StartScheduleTableSynchron, OS_StartScheduleTableSynchron, ScheduleTableType)
+OS_SVC_STUB2(SVC_SyncScheduleTable,      OS_SC_SyncScheduleTable,      OS_SyncScheduleTable,      ScheduleTableType, TickType)
+OS_SVC_STUB1(SVC_SetScheduleTableAsync,  OS_SC_SetScheduleTableAsync,  OS_SetScheduleTableAsync,  ScheduleTableType)
+
+/***********************************************************************************/
+/*                        External Function Declration                             */
+/***********************************************************************************/
+
+/**
+ * @brief Switches the thread mode to the process stack and starts the OS (not inlined).
+ */
+extern FUNC(void, OS_CODE) SVC_StartOS
+(
+    CONST(AppModeType, AUTOMATIC) Mode
+);
+
+#endif /* #if(!defined OS_SYSCALLS_CM4_H) */
+/***********************************************************************************/
+/*				    			 End Of File			         				   */
+/***********************************************************************************/
@@ -4,21 +4,20 @@
 .extern UpdateTaskPSP
 .extern Kernel
 .extern Os_CreateStackFrame
+.extern Os_ThreadUnprivileged
+.extern Os_KernelLockLevel
 
 .section .text
 .thumb
 
 
-.equ SVC_NUMBER_SHIFT,	    -2
 .equ LR_SHIFT,	    		0	
 .equ R4_SHIFT,	 			4
 .equ R5_SHIFT,	 			8
 .equ TEMP_STACK_FOOT_PRINT, 12
 
 	
-.equ OS_N_SYSCALL, 			21	
-.equ PC_SHIFT, 				24
-.equ PC_POSITION,		    24
+.equ OS_N_SYSCALL, 			31	
 
 .equ SchedulerNeededFlag,	18
 .equ NoSchedulerNeeded,		0
@@ -31,26 +30,18 @@
 	
 	
 .global SVC_Handler
+.global PendSV_Handler
 .global NewTaskStackInit
 .global SaveAndSwitchContext
 
 	
  SVC_Handler:
  
-	MRS R0, PSP
-	LDMIA R0,{R0, R1, R2, R3}
-	
-	MRS  R3,PSP
-	LDR  R3,[R3,#PC_SHIFT]
-	LDRB R3 ,[R3,#-2]
+	MRS   R12, PSP
+	LDMIA R12,{R0, R1, R2, R3}
 	
 	CMP R3,#OS_N_SYSCALL
 	BHS InvalidSysCall
-	BLO	SystemCall
-	
-InvalidSysCall:
-
-	BX    LR
 	
 SystemCall:
 	
@@ -63,17 +54,22 @@ SystemCall:
     STR   R4,[SP,#LR_SHIFT]
 	
 	
-	LDR   R4,= OS_syscallTable
-    LSLS  R3,R3,#2
-    LDR   R3,[R4,R3]
+	MOVW  R4,#:lower16:OS_syscallTable
+	MOVT  R4,#:upper16:OS_syscallTable
+    LDR   R3,[R4,R3,LSL #2]
+	CBZ   R3,InvalidService
 		
-	CPSID I
+	LDR   R12,=Os_KernelLockLevel
+	LDRB  R12,[R12]
+	MSR   BASEPRI,R12
 	
     BLX   R3
 	
     MRS   R4,psp
     STR   R0,[R4]
 	
+KernelSchedule:
+	
 	LDR   R4,= Kernel
 	LDRB  R5,[R4,#SchedulerNeededFlag]
 	CMP   R5,#NoSchedulerNeeded
@@ -107,10 +103,40 @@ RestoreNoContextSwitch:
 
     ADD   SP,SP,#TEMP_STACK_FOOT_PRINT
 
-    CPSIE I   	
+    MOV   R12,#0
+    MSR   BASEPRI,R12
 
 	BX LR
 	
+InvalidService:
+
+    LDR   R5,[SP,#R5_SHIFT]
+    LDR   R4,[SP,#R4_SHIFT]
+
+    ADD   SP,SP,#TEMP_STACK_FOOT_PRINT
+	
+InvalidSysCall:
+
+	BX    LR
+	
+	
+PendSV_Handler:
+	
+	SUB   SP,SP,#TEMP_STACK_FOOT_PRINT
+	
+    STR   R4,[SP,#R4_SHIFT]
+    STR   R5,[SP,#R5_SHIFT]
+
+    MOV   R4,LR
+    STR   R4,[SP,#LR_SHIFT]
+	
+	LDR   R12,=Os_KernelLockLevel
+	LDRB  R12,[R12]
+	MSR   BASEPRI,R12
+	
+	MOVS  R0,#0
+	B     KernelSchedule
+	
 	
 NewTaskStackInit:
 		
@@ -163,15 +189,15 @@ SaveAndSwitchContext:
 	POP {LR}
 	
 	
-	CPSIE I
-	
-	PUSH {R0}
-	
-	MRS R0,CONTROL
-	ORR R0,R0,#0x01
-	MSR CONTROL,R0
+	MOV  R1,#0
+	MSR  BASEPRI,R1
 	
-	POP {R0}
+	MRS  R1,CONTROL
+	BIC  R1,R1,#0x01
+	LDR  R2,=Os_ThreadUnprivileged
+	LDRB R2,[R2]
+	ORR  R1,R1,R2
+	MSR  CONTROL,R1
 	
 	
 	BX LR
@@ -0,0 +1,124 @@
+/**
+ * @file            main.c
+ * @author          Mahmoud Ismail
+ * @version         1.0.0
+ * @date            19-10-2026
+ * @platform        x86-64 Linux (host simulation)
+ * @brief Host application running the generated configuration (os/generate).
+ *
+ * Task0 is auto-started, Task1 is activated by the cyclic Alarm0. The tasks declare
+ * their execution time with OS_SimExecute(). In wall clock mode the application stops
+ * after OS_HOST_ACTIVATIONS activations of Task1, in virtual time mode (SIM=1) after
+ * OS_POSIX_SIM_TICKS ticks with the schedule report.
+ *
+ * With OS_HOST_RESTARTS > 0 (wall clock mode) Task1 warm restarts the OS with RestartOS
+ * instead of exiting, Task0 prints the latency from the call to its own start.
+ */
+
+/**********************************************************************************/
+/**				    			Include Headers			         				 **/
+/**********************************************************************************/
+#include <Os.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/***********************************************************************************/
+/*  			    			    Macros				         				   */
+/***********************************************************************************/
+
+/* Number of Task1 activations before the application exits */
+#if (!defined OS_HOST_ACTIVATIONS)
+#define OS_HOST_ACTIVATIONS		(10U)
+#endif /* #if (!defined OS_HOST_ACTIVATIONS) */
+
+/* Number of warm restarts before the application exits */
+#if (!defined OS_HOST_RESTARTS)
+#define OS_HOST_RESTARTS		(0U)
+#endif /* #if (!defined OS_HOST_RESTARTS) */
+
+/* Execution times of the tasks in microseconds */
+#if (!defined OS_HOST_TASK0_COST)
+#define OS_HOST_TASK0_COST		(7000U)
+#endif /* #if (!defined OS_HOST_TASK0_COST) */
+
+#if (!defined OS_HOST_TASK1_COST)
+#define OS_HOST_TASK1_COST		(1200U)
+#endif /* #if (!defined OS_HOST_TASK1_COST) */
+
+/***********************************************************************************/
+/*                              Internal Global Variables                          */
+/***********************************************************************************/
+
+static volatile uint32 Task1Activations = 0;
+
+/* Warm restarts done and time stamp of the last RestartOS call */
+static volatile uint32 Restarts = 0;
+static volatile uint32 RestartStart = 0;
+
+/***********************************************************************************/
+/*				    	 External Functions Definition		      				   */
+/***********************************************************************************/
+
+TASK(Task0)
+{
+#if (OS_POSIX_VIRTUAL_TIME == STD_OFF)
+	if (0U != Restarts)
+	{
+		(void)printf("Task0: started %u us after RestartOS (restart %u)\n", OS_PosixTimestamp() - RestartStart, Restarts);
+	}
+	else
+	{
+		(void)printf("Task0: started\n");
+	}
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_OFF) */
+
+	OS_SimExecute(OS_HOST_TASK0_COST);
+
+	TerminateTask();
+}
+
+TASK(Task1)
+{
+	TickType RemainingTicks = 0;
+
+	Task1Activations++;
+
+	OS_SimExecute(OS_HOST_TASK1_COST);
+
+	(void)GetAlarm(Alarm0, &RemainingTicks);
+
+#if (OS_POSIX_VIRTUAL_TIME == STD_OFF)
+	(void)printf("Task1: activation %u, next in %u ticks\n", Task1Activations, RemainingTicks);
+
+	if (Task1Activations >= OS_HOST_ACTIVATIONS)
+	{
+#if (OS_HOST_RESTARTS > 0U)
+		if (Restarts < OS_HOST_RESTARTS)
+		{
+			Restarts++;
+			Task1Activations = 0;
+			RestartStart = OS_PosixTimestamp();
+
+			(void)RestartOS(OSDEFAULTAPPMODE);
+		}
+#endif /* #if (OS_HOST_RESTARTS > 0U) */
+
+		ShutdownOS(E_OK);
+	}
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_OFF) */
+
+	TerminateTask();
+}
+
+int main(void)
+{
+	StartOS(OSDEFAULTAPPMODE);
+
+	/* StartOS does not return */
+	return EXIT_FAILURE;
+}
+
+/***********************************************************************************/
+/*				    			 End Of File			         				   */
+/***********************************************************************************/
@@ -0,0 +1,475 @@
+/**
+ * @file            Os_AlarmBench.c
+ * @author          Mahmoud Ismail
+ * @version         1.0.0
+ * @date            19-10-2026
+ * @platform        x86-64 Linux (host simulation)
+ * @brief Host benchmark of the alarm queue selected by OS_ALARM_QUEUE.
+ *
+ * OS_ALARM_BENCH_MAX cyclic callback alarms are attached to the system counter
+ * (Counters[0]), the OS is not started. For 10, 100 and 1000 active alarms the
+ * benchmark measures:
+ *  - cancel / set-rel : OS_AlarmQueueRemove() and OS_AlarmQueueInsert() as done by
+ *    CancelAlarm() and SetRelAlarm(), average per call over batches of N/10 alarms.
+ *  - tick             : OS_IncrementHardwreCounter(), the body of the tick ISR, average
+ *    and worst case per tick in time stamp counter cycles of the host (ns elsewhere),
+ *    and average of the quiet ticks, the ones expiring no alarm.
+ * The number of expiries is checked against the one computed from the delays and the
+ * cycles of the alarms, then again with the same alarms and OS_AdvanceHardwareCounter()
+ * in random steps of up to OS_ALARM_BENCH_RANGE ticks. Built and run by "make bench", once per queue, with
+ * OS_ALARM_HEAP_SIZE raised to OS_ALARM_BENCH_MAX.
+ *
+ * With OS_ALARM_SLACK, the same random cyclic alarms run once without slack and once
+ * with a slack of OS_ALARM_BENCH_SLACK percent of their cycle: the wake-up ticks, the
+ * ticks expiring at least one alarm, are compared.
+ *
+ * A cascade check runs last: an ALARM_INCREMENT_COUNTER alarm of Counter2 and two callback
+ * alarms, all due on the same ticks of Counters[0], the increment queued first. Every alarm
+ * must expire on each of its ticks although Counter2 ticks nested in the expiry of Counters[0].
+ */
+
+/**********************************************************************************/
+/**				    			Include Headers			         				 **/
+/**********************************************************************************/
+#include <Os.h>
+#include <Os_kernel.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/***********************************************************************************/
+/*  			    			    Macros				         				   */
+/***********************************************************************************/
+
+/* Largest number of active alarms */
+#if (!defined OS_ALARM_BENCH_MAX)
+#define OS_ALARM_BENCH_MAX		(1000U)
+#endif /* #if (!defined OS_ALARM_BENCH_MAX) */
+
+/* Ticks of the tick measurement */
+#if (!defined OS_ALARM_BENCH_TICKS)
+#define OS_ALARM_BENCH_TICKS	(100000U)
+#endif /* #if (!defined OS_ALARM_BENCH_TICKS) */
+
+/* Cancel / set-rel rounds per size */
+#if (!defined OS_ALARM_BENCH_ROUNDS)
+#define OS_ALARM_BENCH_ROUNDS	(2000U)
+#endif /* #if (!defined OS_ALARM_BENCH_ROUNDS) */
+
+/* Largest delay and cycle of an alarm in ticks */
+#define OS_ALARM_BENCH_RANGE	(1000U)
+
+/* Slack of the coalesced alarms in percent of their cycle */
+#if (!defined OS_ALARM_BENCH_SLACK)
+#define OS_ALARM_BENCH_SLACK	(10U)
+#endif /* #if (!defined OS_ALARM_BENCH_SLACK) */
+
+/***********************************************************************************/
+/*                              Internal Global Variables                          */
+/***********************************************************************************/
+
+static uint32 Expiries = 0;
+
+static void BenchCallback(void)
+{
+	Expiries++;
+}
+
+static Os_Alarm BenchAlarms[OS_ALARM_BENCH_MAX] =
+{
+	[0 ... (OS_ALARM_BENCH_MAX - 1U)] =
+	{
+		.OsAlarmAction =
+		{
+			.OsAlarmCallbackName = BenchCallback,
+		},
+		.OsAlarmCounterRef = &Counters[0],
+		.OsAlarmActionType = ALARM_CALLBACK,
+		.OsAlarmState = ALARM_SLEEP,
+#if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_HEAP)
+		.OsAlarmHeapIndex = OS_ALARM_HEAP_NONE
+#endif /* #if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_HEAP) */
+	}
+};
+
+/* Cascade check: Counter2 incremented by an alarm of Counters[0] */
+static uint32 CascadeExpiries[2] = { 0U, 0U };
+
+static void CascadeCallbackB(void)
+{
+	CascadeExpiries[0]++;
+}
+
+static void CascadeCallbackC(void)
+{
+	CascadeExpiries[1]++;
+}
+
+static Os_AlarmIncrementCounter CascadeIncrement =
+{
+	.OsAlarmIncrementCounterRef = Counter2
+};
+
+static Os_Alarm CascadeAlarms[3] =
+{
+	{
+		.OsAlarmAction = { .OsAlarmIncrementCounter = &CascadeIncrement },
+		.OsAlarmCounterRef = &Counters[0],
+		.OsAlarmActionType = ALARM_INCREMENT_COUNTER,
+		.OsAlarmState = ALARM_SLEEP,
+#if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_HEAP)
+		.OsAlarmHeapIndex = OS_ALARM_HEAP_NONE
+#endif /* #if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_HEAP) */
+	},
+	{
+		.OsAlarmAction = { .OsAlarmCallbackName = CascadeCallbackB },
+		.OsAlarmCounterRef = &Counters[0],
+		.OsAlarmActionType = ALARM_CALLBACK,
+		.OsAlarmState = ALARM_SLEEP,
+#if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_HEAP)
+		.OsAlarmHeapIndex = OS_ALARM_HEAP_NONE
+#endif /* #if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_HEAP) */
+	},
+	{
+		.OsAlarmAction = { .OsAlarmCallbackName = CascadeCallbackC },
+		.OsAlarmCounterRef = &Counters[0],
+		.OsAlarmActionType = ALARM_CALLBACK,
+		.OsAlarmState = ALARM_SLEEP,
+#if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_HEAP)
+		.OsAlarmHeapIndex = OS_ALARM_HEAP_NONE
+#endif /* #if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_HEAP) */
+	}
+};
+
+/***********************************************************************************/
+/*				    	 Internal Functions Definition		      				   */
+/***********************************************************************************/
+
+static uint64 BenchNow(void)
+{
+	struct timespec Now;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &Now);
+
+	return ((uint64)Now.tv_sec * 1000000000ULL) + (uint64)Now.tv_nsec;
+}
+
+/* Time stamp counter of x86 hosts, ns elsewhere */
+static uint64 BenchCycles(void)
+{
+#if (defined __x86_64__) || (defined __i386__)
+	return (uint64)__builtin_ia32_rdtsc();
+#else
+	return BenchNow();
+#endif /* #if (defined __x86_64__) || (defined __i386__) */
+}
+
+static uint32 BenchRandom(void)
+{
+	return 1U + ((uint32)rand() % OS_ALARM_BENCH_RANGE);
+}
+
+/* SetRelAlarm() without the checks */
+static void BenchSetRel(Os_Alarm *Alarm, TickType Increment, TickType Cycle)
+{
+	Os_Counter *Counter = Alarm->OsAlarmCounterRef;
+
+	Alarm->OsAlarmExpiryTime = (Counter->OsCounterCurrentTicks + Increment) % (Counter->OsCounterMaxAllowedValue + 1U);
+	Alarm->OsAlarmCycleTime  = Cycle;
+	Alarm->OsAlarmState      = ALARM_ACTIVE;
+	OS_AlarmQueueInsert(Alarm);
+}
+
+/* CancelAlarm() without the checks */
+static void BenchCancel(Os_Alarm *Alarm)
+{
+	Alarm->OsAlarmState = ALARM_SLEEP;
+	OS_AlarmQueueRemove(Alarm);
+}
+
+static int BenchRun(uint32 Size)
+{
+	static uint32 Delays[OS_ALARM_BENCH_MAX];
+	static uint32 Cycles[OS_ALARM_BENCH_MAX];
+	uint32 Advanced;
+	uint32 Step;
+	uint32 TickExpiries;
+	uint32 Batch = (Size >= 10U) ? (Size / 10U) : 1U;
+	uint32 Index;
+	uint32 Round;
+	uint32 Picked[OS_ALARM_BENCH_MAX];
+	uint64 Start;
+	uint64 Duration;
+	uint64 CancelTime = 0U;
+	uint64 SetTime = 0U;
+	uint64 TickTime = 0U;
+	uint64 TickMax = 0U;
+	uint64 QuietTime = 0U;
+	uint32 Quiet = 0U;
+	uint32 Before;
+	uint32 Expected = 0U;
+
+	Counters[0].OsCounterCurrentTicks = 0U;
+	OS_AlarmQueueInit(&Counters[0]);
+
+	for (Index = 0U; Index < Size; Index++)
+	{
+		BenchSetRel(&BenchAlarms[Index], BenchRandom(), BenchRandom());
+	}
+
+	/* Cancel and set again N/10 random alarms */
+	for (Round = 0U; Round < OS_ALARM_BENCH_ROUNDS; Round++)
+	{
+		for (Index = 0U; Index < Batch; Index++)
+		{
+			Picked[Index] = (uint32)rand() % Size;
+		}
+
+		/* An alarm picked twice is cancelled and set once */
+		Start = BenchNow();
+		for (Index = 0U; Index < Batch; Index++)
+		{
+			if (ALARM_ACTIVE == BenchAlarms[Picked[Index]].OsAlarmState)
+			{
+				BenchCancel(&BenchAlarms[Picked[Index]]);
+			}
+		}
+		CancelTime += BenchNow() - Start;
+
+		Start = BenchNow();
+		for (Index = 0U; Index < Batch; Index++)
+		{
+			if (ALARM_SLEEP == BenchAlarms[Picked[Index]].OsAlarmState)
+			{
+				BenchSetRel(&BenchAlarms[Picked[Index]], BenchRandom(), BenchRandom());
+			}
+		}
+		SetTime += BenchNow() - Start;
+
+		/* Spread the expiries of the next round */
+		OS_IncrementHardwreCounter(&Counters[0]);
+	}
+
+	/* Fresh alarms with known delays for the expiry check */
+	OS_AlarmQueueInit(&Counters[0]);
+
+	for (Index = 0U; Index < Size; Index++)
+	{
+		Delays[Index] = BenchRandom();
+		Cycles[Index] = BenchRandom();
+		BenchAlarms[Index].OsAlarmState = ALARM_SLEEP;
+		BenchSetRel(&BenchAlarms[Index], Delays[Index], Cycles[Index]);
+
+		Expected += 1U + ((OS_ALARM_BENCH_TICKS - Delays[Index]) / BenchAlarms[Index].OsAlarmCycleTime);
+	}
+
+	Expiries = 0U;
+
+	for (Round = 0U; Round < OS_ALARM_BENCH_TICKS; Round++)
+	{
+		Before = Expiries;
+
+		Start = BenchCycles();
+		OS_IncrementHardwreCounter(&Counters[0]);
+		Duration = BenchCycles() - Start;
+
+		if (Before == Expiries)
+		{
+			QuietTime += Duration;
+			Quiet++;
+		}
+
+		TickTime += Duration;
+		if (Duration > TickMax)
+		{
+			TickMax = Duration;
+		}
+	}
+
+	TickExpiries = Expiries;
+
+	/* Same alarms, the counter advanced in random steps */
+	Counters[0].OsCounterCurrentTicks = 0U;
+	OS_AlarmQueueInit(&Counters[0]);
+
+	for (Index = 0U; Index < Size; Index++)
+	{
+		BenchAlarms[Index].OsAlarmState = ALARM_SLEEP;
+		BenchSetRel(&BenchAlarms[Index], Delays[Index], Cycles[Index]);
+	}
+
+	Expiries = 0U;
+
+	for (Advanced = 0U; Advanced < OS_ALARM_BENCH_TICKS; Advanced += Step)
+	{
+		Step = BenchRandom();
+		if (Step > (OS_ALARM_BENCH_TICKS - Advanced))
+		{
+			Step = OS_ALARM_BENCH_TICKS - Advanced;
+		}
+
+		OS_AdvanceHardwareCounter(&Counters[0], (TickType)Step);
+	}
+
+	(void)printf("%6u alarms: cancel %7.1f ns, set-rel %7.1f ns, tick %7.1f cycles (quiet %5.1f, max %7llu), expiries %u/%u, advance %u\n",
+	             Size,
+	             (double)CancelTime / (double)(OS_ALARM_BENCH_ROUNDS * Batch),
+	             (double)SetTime / (double)(OS_ALARM_BENCH_ROUNDS * Batch),
+	             (double)TickTime / (double)OS_ALARM_BENCH_TICKS,
+	             (0U != Quiet) ? ((double)QuietTime / (double)Quiet) : 0.0,
+	             TickMax, TickExpiries, Expected, Expiries);
+
+	for (Index = 0U; Index < Size; Index++)
+	{
+		BenchAlarms[Index].OsAlarmState = ALARM_SLEEP;
+	}
+
+	return ((TickExpiries == Expected) && (Expiries == Expected)) ? 0 : 1;
+}
+
+#if (OS_ALARM_SLACK == STD_ON)
+/* Wake-up ticks of <Size> random cyclic alarms with a slack of <Percent> of their cycle */
+static uint32 BenchWakeups(uint32 Size, uint32 Percent, uint32 *ExpiryCount)
+{
+	uint32 Index;
+	uint32 Round;
+	uint32 Before;
+	uint32 Wakeups = 0U;
+	TickType Cycle;
+
+	/* The same alarms for every slack */
+	srand(2U + Size);
+
+	Counters[0].OsCounterCurrentTicks = 0U;
+	OS_AlarmQueueInit(&Counters[0]);
+
+	for (Index = 0U; Index < Size; Index++)
+	{
+		Cycle = (TickType)BenchRandom();
+		BenchAlarms[Index].OsAlarmState = ALARM_SLEEP;
+		BenchAlarms[Index].OsAlarmSlack = (TickType)((Cycle * Percent) / 100U);
+		BenchSetRel(&BenchAlarms[Index], BenchRandom(), Cycle);
+	}
+
+	Expiries = 0U;
+
+	for (Round = 0U; Round < OS_ALARM_BENCH_TICKS; Round++)
+	{
+		Before = Expiries;
+
+		OS_IncrementHardwreCounter(&Counters[0]);
+
+		if (Before != Expiries)
+		{
+			Wakeups++;
+		}
+	}
+
+	for (Index = 0U; Index < Size; Index++)
+	{
+		BenchAlarms[Index].OsAlarmState = ALARM_SLEEP;
+		BenchAlarms[Index].OsAlarmSlack = 0U;
+	}
+
+	*ExpiryCount = Expiries;
+
+	return Wakeups;
+}
+
+static int BenchCoalesce(uint32 Size)
+{
+	uint32 Exact;
+	uint32 Slack;
+	uint32 ExactExpiries;
+	uint32 SlackExpiries;
+
+	Exact = BenchWakeups(Size, 0U, &ExactExpiries);
+	Slack = BenchWakeups(Size, OS_ALARM_BENCH_SLACK, &SlackExpiries);
+
+	(void)printf("%6u alarms: wake-up ticks %6u, %6u with a slack of %u %% of the cycle (-%.1f %%), expiries %u/%u\n",
+	             Size, Exact, Slack, OS_ALARM_BENCH_SLACK,
+	             (0U != Exact) ? (100.0 * (double)(Exact - Slack) / (double)Exact) : 0.0,
+	             SlackExpiries, ExactExpiries);
+
+	/* The cycles count from the expiries without slack: only the last expiry of an alarm
+	   can be pushed out of the measurement */
+	return ((SlackExpiries <= ExactExpiries) && ((ExactExpiries - SlackExpiries) <= Size) && (Slack <= Exact)) ? 0 : 1;
+}
+#endif /* #if (OS_ALARM_SLACK == STD_ON) */
+
+/* Alarms of Counters[0] due on the same ticks as an alarm cascading to Counter2 */
+static int BenchCascade(void)
+{
+	uint32 Index;
+	uint32 Round;
+
+	Counters[0].OsCounterCurrentTicks       = 0U;
+	Counters[Counter2].OsCounterCurrentTicks = 0U;
+	OS_AlarmQueueInit(&Counters[0]);
+	OS_AlarmQueueInit(&Counters[Counter2]);
+
+	/* The increment first: it is the first one expired on each tick */
+	for (Index = 0U; Index < 3U; Index++)
+	{
+		BenchSetRel(&CascadeAlarms[Index], 10U, 10U);
+	}
+
+	for (Round = 0U; Round < 100U; Round++)
+	{
+		OS_IncrementHardwreCounter(&Counters[0]);
+	}
+
+	(void)printf("cascade: callbacks %u, %u, Counter2 %u (10 expected)\n",
+	             CascadeExpiries[0], CascadeExpiries[1], (uint32)Counters[Counter2].OsCounterCurrentTicks);
+
+	for (Index = 0U; Index < 3U; Index++)
+	{
+		BenchCancel(&CascadeAlarms[Index]);
+	}
+
+	return ((10U == CascadeExpiries[0]) && (10U == CascadeExpiries[1]) &&
+	        (10U == Counters[Counter2].OsCounterCurrentTicks)) ? 0 : 1;
+}
+
+/***********************************************************************************/
+/*				    	 External Functions Definition		      				   */
+/***********************************************************************************/
+
+/* Task bodies of the generated configuration, never started */
+TASK(Task0)
+{
+	TerminateTask();
+}
+
+TASK(Task1)
+{
+	TerminateTask();
+}
+
+int main(void)
+{
+	int Failures = 0;
+
+	srand(1U);
+
+	(void)printf("Alarm queue %u (0 list, 1 wheel, 2 heap, 3 delta)\n", (uint32)OS_ALARM_QUEUE);
+
+	Failures += BenchRun(10U);
+	Failures += BenchRun(100U);
+	Failures += BenchRun(OS_ALARM_BENCH_MAX);
+
+#if (OS_ALARM_SLACK == STD_ON)
+	Failures += BenchCoalesce(10U);
+	Failures += BenchCoalesce(100U);
+	Failures += BenchCoalesce(OS_ALARM_BENCH_MAX);
+#endif /* #if (OS_ALARM_SLACK == STD_ON) */
+
+	Failures += BenchCascade();
+
+	return (0 == Failures) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/***********************************************************************************/
+/*				    			 End Of File			         				   */
+/***********************************************************************************/
@@ -0,0 +1,269 @@
+ /**
+ * @file Os_kernel_posix.h
+ * @author Mahmoud Ismail
+ * @version 1.0.0
+ * @date 19-10-2026
+ * @platform x86-64 Linux (host simulation)
+ * @brief This files contains the POSIX host dependent code for OS kernel.
+ *
+ * Tasks run on ucontext stacks inside a single process, SysTick is emulated
+ * by a periodic SIGALRM and the SVC entry / interrupt locks are emulated by
+ * blocking the interrupt signals of the process.
+ *
+*/
+
+/*------------------------- MISRA-C vailoations in c files -----------------------*/
+#if(!defined OS_KERNEL_POSIX_H)
+#define OS_KERNEL_POSIX_H
+
+
+/**********************************************************************************/
+/*                               INCLUDE HEADERS	                              */
+/**********************************************************************************/
+
+#include <signal.h>
+#include <ucontext.h>
+
+/* Virtual time mode */
+#include <Os_sim_posix.h>
+
+
+/***********************************************************************************/
+/*                                  MACROS                                         */
+/***********************************************************************************/
+
+/**
+ * @brief Period of the emulated SysTick in microseconds.
+ *
+ * With OS_COUNTER_COMPARE_TIMER the period of one count of the stand-in timer, the
+ * resolution of the alarms.
+ *
+ * Can be overridden from the build command line to run the system faster or slower
+ * than the 1 ms tick used on the target.
+ */
+#if (!defined OS_POSIX_TICK_PERIOD_US)
+#define OS_POSIX_TICK_PERIOD_US                    (1000U)
+#endif /* #if (!defined OS_POSIX_TICK_PERIOD_US) */
+
+/**
+ * @brief Size in bytes of the host stack given to every task.
+ *
+ * The generated TaskStackType describes target memory and is not usable on the host,
+ * the C library of the host also needs much more stack than the target tasks.
+ */
+#if (!defined OS_POSIX_STACK_SIZE)
+#define OS_POSIX_STACK_SIZE                        (0x10000U)
+#endif /* #if (!defined OS_POSIX_STACK_SIZE) */
+
+/**
+ * @brief Signal used to emulate the SysTick interrupt.
+ */
+#define OS_POSIX_TICK_SIGNAL                       SIGALRM
+
+/**
+ * @brief Number of simulated timers, the tick sources of the hardware counters with a
+ * driver (Os_PosixTimerStart), indexed by OsCounterDriverChannel.
+ */
+#if (!defined OS_POSIX_TIMER_COUNT)
+#define OS_POSIX_TIMER_COUNT                       (4U)
+#endif /* #if (!defined OS_POSIX_TIMER_COUNT) */
+
+/**
+ * @brief Signal used to emulate the interrupt of the simulated timer <Channel>.
+ */
+#define OS_POSIX_TIMER_SIGNAL(Channel)             (SIGRTMIN + (int)(Channel))
+
+
+/**
+ * @brief Dispatches the operating system by switching to the running task.
+ *
+ * On the host there is no PendSV, the switch is done immediately.
+ */
+#define OS_DISPATCH()                              SaveAndSwitchContext()
+
+/**
+ * @brief Rescheduling at the exit of the outermost Category 2 ISR.
+ *
+ * Done in the signal handler, the interrupted task is resumed by swapcontext.
+ */
+#define OS_ISR_DISPATCH()                          OS_PosixDispatch()
+
+
+/**
+ * @brief End of ShutdownOS: the host process exits.
+ */
+#define OS_SHUTDOWN_HALT()                         OS_PosixShutdown()
+
+/**
+ * @brief Time stamp of the lock measurements: microseconds of the host.
+ */
+#define OS_TIMESTAMP()                             OS_PosixTimestamp()
+
+/**
+ * @brief Orders the accesses to the counter time snapshots against the signal handlers.
+ */
+#define OS_MEMORY_BARRIER()                        __asm volatile ("" ::: "memory")
+
+/**
+ * @brief Section of the counter time snapshots, no memory protection on the host.
+ */
+#define OS_COUNTER_TIME_SECTION
+
+
+/**
+ * @brief Kernel lock, the emulated interrupts are already blocked in the kernel.
+ */
+#define OS_KERNEL_LOCK()
+#define OS_KERNEL_UNLOCK()
+
+
+/**
+ * @brief Defines the macro to invoke the idle task for the POSIX port.
+ */
+#define OS_Idle()	OS_CoretexIdle()
+
+/**
+ * @brief Sleep of the dispatcher waiting in idle (OS_CONTEXTLESS_IDLE).
+ */
+#define OS_IDLE_WAIT()                             OS_PosixIdleWait()
+
+
+
+/*************************************************************************************/
+/*                                 TypeDefnitions                                    */
+/*************************************************************************************/
+
+/**
+ * @brief Architecture dependent context of a task.
+ */
+typedef  struct
+{
+	/*! Saved user context of the task */
+	ucontext_t Context;
+}Os_ContexType;
+
+/*! Type of a system call table entry as called by the host SVC emulation */
+typedef unsigned char (*Os_PosixSyscallPtrType)(unsigned long Arg0, unsigned long Arg1, unsigned long Arg2);
+
+
+/***********************************************************************************/
+/*                        External Function Declration                             */
+/***********************************************************************************/
+
+/**
+ * @brief Creates the initial context of the running task on its host stack.
+ */
+void Os_CreateStackFrame(void);
+
+/**
+ * @brief Function to start a task.
+ */
+void OS_StartTask(void *PrevTas);
+
+/**
+ * @brief Resumes the execution of a suspended task.
+ */
+void OS_ResumeTask(void *PrevTas);
+
+/**
+ * @brief Idle loop of the host, sleeps until the next signal (the host "wfi").
+ */
+void OS_CoretexIdle(void);
+
+/**
+ * @brief Sleeps until the next emulated interrupt was handled, called in the kernel with
+ * the interrupt signals blocked (sigsuspend unblocks them atomically).
+ */
+void OS_PosixIdleWait(void);
+
+void OS_EnterKernel(void);
+
+void OS_LeaveKernel(void);
+
+/**
+ * @brief Saves the context of Kernel.TaskPreempted and resumes Kernel.TaskRunning.
+ */
+void SaveAndSwitchContext(void);
+
+/**
+ * @brief Creates the context of the new running task and switches to it.
+ */
+void NewTaskStackInit(int Source);
+
+/**
+ * @brief Emulates the SVC exception: calls the service <ServiceId> of the system call
+ * table with interrupts locked and runs the scheduler and dispatcher afterwards.
+ *
+ * @param[in] ServiceId   OS_SC_xxx number of the service.
+ * @param[in] Arg0        First argument (R0 on the target).
+ * @param[in] Arg1        Second argument (R1 on the target).
+ * @param[in] Arg2        Third argument (R2 on the target).
+ * @return    Return value of the service.
+ */
+unsigned char OS_PosixSystemCall(unsigned char ServiceId, unsigned long Arg0, unsigned long Arg1, unsigned long Arg2);
+
+/**
+ * @brief Runs the scheduler and the dispatcher if Kernel.SchedulerNeeded is set, the
+ * end of the emulated SVC and of the outermost Category 2 ISR.
+ */
+void OS_PosixDispatch(void);
+
+/**
+ * @brief Locks the emulated interrupts and returns the previous lock state.
+ */
+void OS_PosixDisableInterrupts(sigset_t *PreviousMask);
+
+/**
+ * @brief Restores the emulated interrupt lock state saved by OS_PosixDisableInterrupts().
+ */
+void OS_PosixRestoreInterrupts(const sigset_t *PreviousMask);
+
+/**
+ * @brief Halts the host "core": flushes the output and exits the process.
+ */
+void OS_PosixShutdown(void);
+
+/**
+ * @brief Returns the time in microseconds, the virtual clock in virtual time mode.
+ */
+uint32 OS_PosixTimestamp(void);
+
+/**
+ * @brief Installs the tick signal handler and starts the periodic tick timer.
+ */
+void OS_PosixStartTick(void);
+
+/**
+ * @brief SysTick handler of the kernel (Counters.c).
+ */
+void SysTick_Handler(void);
+
+/**
+ * @brief Compare timer stand-in (OS_COUNTER_COMPARE_TIMER), see Os_kernel_counter.h.
+ */
+void Os_CounterTimerStart(void);
+
+uint32 Os_CounterTimerRead(void);
+
+void Os_CounterTimerSetCompare(uint32 Compare);
+
+/* Os_CounterDriver, this header is included before Os_kernel_counter.h */
+struct Os_CounterDriver_s;
+
+/**
+ * @brief Start function of the counter drivers on the host: runs the simulated timer
+ * OsCounterDriverChannel with a period of OsCounterDriverPeriod microseconds, its
+ * interrupt raises OsCounterDriverIsr.
+ */
+void Os_PosixTimerStart(const struct Os_CounterDriver_s *Driver);
+
+/**
+ * @brief Returns TRUE and clears the request if SysTick pended the deferred expiry handler
+ * (OS_TICK_DEFERRED), the caller raises CounterTimer_Handler().
+ */
+boolean OS_PosixDeferredTake(void);
+
+#endif /* #if(!defined OS_KERNEL_POSIX_H) */
+/***********************************************************************************/
+/*				    			 End Of File			         				   */
+/***********************************************************************************/
@@ -0,0 +1,149 @@
+ /**
+ * @file Os_sim_posix.h
+ * @author Mahmoud Ismail
+ * @version 1.0.0
+ * @date 19-10-2026
+ * @platform x86-64 Linux (host simulation)
+ * @brief Deterministic virtual time mode of the POSIX host port.
+ *
+ * With OS_POSIX_VIRTUAL_TIME == STD_ON the SysTick is not driven by the wall clock
+ * but by a discrete virtual clock. Time only advances while a task declares execution
+ * cost with OS_SimExecute() or while the system is idle, the kernel itself executes in
+ * zero virtual time. The same configuration therefore always produces the same schedule,
+ * response times and CPU load, and hours of operation are simulated in seconds.
+ *
+*/
+
+/*------------------------- MISRA-C vailoations in c files -----------------------*/
+#if(!defined OS_SIM_POSIX_H)
+#define OS_SIM_POSIX_H
+
+
+/**********************************************************************************/
+/*                               INCLUDE HEADERS	                              */
+/**********************************************************************************/
+
+#include <Std_Types.h>
+
+
+/***********************************************************************************/
+/*                                  MACROS                                         */
+/***********************************************************************************/
+
+/**
+ * @brief Selects the virtual time mode (STD_ON) or the wall clock mode (STD_OFF).
+ */
+#if (!defined OS_POSIX_VIRTUAL_TIME)
+#define OS_POSIX_VIRTUAL_TIME                      STD_OFF
+#endif /* #if (!defined OS_POSIX_VIRTUAL_TIME) */
+
+/**
+ * @brief Length of the simulation in ticks, the report is printed when it is reached.
+ */
+#if (!defined OS_POSIX_SIM_TICKS)
+#define OS_POSIX_SIM_TICKS                         (10000U)
+#endif /* #if (!defined OS_POSIX_SIM_TICKS) */
+
+/**
+ * @brief Prints every dispatch of the simulation (STD_ON) with its virtual time stamp.
+ */
+#if (!defined OS_POSIX_SIM_TRACE)
+#define OS_POSIX_SIM_TRACE                         STD_OFF
+#endif /* #if (!defined OS_POSIX_SIM_TRACE) */
+
+/**
+ * @brief Maximum number of pending activations recorded per task for the response times.
+ */
+#if (!defined OS_POSIX_SIM_MAX_ACTIVATIONS)
+#define OS_POSIX_SIM_MAX_ACTIVATIONS               (8U)
+#endif /* #if (!defined OS_POSIX_SIM_MAX_ACTIVATIONS) */
+
+
+/*************************************************************************************/
+/*                                 TypeDefnitions                                    */
+/*************************************************************************************/
+
+/*! Virtual time in microseconds */
+typedef uint64 Os_SimTimeType;
+
+
+/***********************************************************************************/
+/*                        External Function Declration                             */
+/***********************************************************************************/
+
+/**
+ * @brief Declares <Cost> microseconds of execution of the running task.
+ *
+ * In virtual time the clock is advanced by <Cost>, the ticks crossed on the way are
+ * raised at their exact time and may preempt the task, the rest of the cost is consumed
+ * when the task is resumed. In wall clock mode the call busy-waits <Cost> microseconds.
+ *
+ * @param[in] Cost    Execution time in microseconds.
+ */
+void OS_SimExecute(uint32 Cost);
+
+/**
+ * @brief Returns the current virtual time in microseconds (wall clock mode: 0).
+ */
+Os_SimTimeType OS_SimGetTime(void);
+
+/**
+ * @brief Prints the schedule statistics collected since StartOS.
+ *
+ * Per task: activations, completed jobs, execution time and best, worst and average
+ * response time (activation to termination). For the system: CPU load, dispatches and
+ * the tick interrupts per second that wake the core up.
+ */
+void OS_SimReport(void);
+
+#if (OS_POSIX_VIRTUAL_TIME == STD_ON)
+
+/**
+ * @brief Idle loop of the virtual time mode, advances the clock to the next tick.
+ */
+void OS_SimIdle(void);
+
+/**
+ * @brief Sleep of the dispatcher waiting in idle (OS_CONTEXTLESS_IDLE): advances the
+ * clock to the next tick, the time is accounted as idle time.
+ */
+void OS_SimIdleWait(void);
+
+/**
+ * @brief Records the changes of the task activations done by the last kernel call.
+ */
+void OS_SimTrace(void);
+
+/**
+ * @brief Records the dispatch of Kernel.TaskRunning.
+ */
+void OS_SimDispatch(void);
+
+/**
+ * @brief Raises the next tick <Ticks> tick periods after the previous one (tickless idle).
+ * Returns the virtual time of that tick.
+ */
+Os_SimTimeType OS_SimDelayTick(uint32 Ticks);
+
+/**
+ * @brief Raises the compare interrupt of the timer stand-in at the virtual time <Time>
+ * instead of the periodic tick (OS_COUNTER_COMPARE_TIMER). Without the compare timer,
+ * the periodic tick resumes at <Time> (early end of a tickless sleep).
+ */
+void OS_SimSetCompare(Os_SimTimeType Time);
+
+/* Os_CounterDriver, this header is included before Os_kernel_counter.h */
+struct Os_CounterDriver_s;
+
+/**
+ * @brief Raises the interrupt of the simulated timer of <Driver> every OsCounterDriverPeriod
+ * microseconds from now on (Os_PosixTimerStart).
+ */
+void OS_SimTimerStart(const struct Os_CounterDriver_s *Driver);
+
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_ON) */
+
+#endif /* #if(!defined OS_SIM_POSIX_H) */
+/***********************************************************************************/
+/*				    			 End Of File			         				   */
+/***********************************************************************************/
@@ -0,0 +1,498 @@
+/**
+ * @file            Os_AlarmPhase.c
+ * @author          Mahmoud Ismail
+ * @version         1.0.0
+ * @date            19-10-2026
+ * @platform        x86-64 Linux (host simulation)
+ * @brief Host tool placing the first expiry of the cyclic autostart alarms.
+ *
+ * StartOS starts the autostart alarms of an application mode at their OsAlarmAlarmTime:
+ * alarms with the same start and commensurate cycles expire on the same ticks once per
+ * hyperperiod, the tasks they activate are released together. For each application mode
+ * and counter of the generated configuration, the tool places the first expiry of the
+ * cyclic autostart alarms releasing a task (ALARM_ACTIVATE_TASK, ALARM_SET_EVENT) to make
+ * the largest number of releases on one tick (the peak) as small as possible.
+ *
+ * The alarms are placed one by one, the pinned ones then the most frequent first,
+ * each at the offset of its window giving the smallest peak, then the fewest releases met,
+ * then the earliest expiry. The releases are counted over the hyperperiod of the cycles,
+ * at most OS_ALARM_PHASE_HORIZON ticks. The unplaced offsets are kept if the placement
+ * does not lower their peak.
+ *
+ * The placement does not read the OsAlarmAlarmTime it generates: an alarm is unplaced at
+ * its cycle (first expiry one cycle after StartOS), the argument <AlarmID>:<Time> sets
+ * another unplaced offset. The report is the same before and after its values are applied.
+ * The window of an alarm is [unplaced, unplaced + cycle - 1] by default: the first expiry
+ * is only delayed, by less than a cycle. The arguments <AlarmID>:<Earliest>:<Latest> set
+ * the window of an alarm, <AlarmID>:<Time>:<Time> pins it.
+ *
+ * Built and run by "make phase [PHASE=...]", the OS is not started. Prints the peak before
+ * and after and the OsAlarmAlarmTime values to generate.
+ *
+ * A self-test runs first and fails the tool if the placement regresses: two alarms of the
+ * cycles 5 and 10 unplaced at their cycle (peak 2 -> 1), then the same with a third alarm
+ * of the cycle 10 pinned at 12 (peak 3 -> 1, the pin kept).
+ */
+
+/**********************************************************************************/
+/**				    			Include Headers			         				 **/
+/**********************************************************************************/
+#include <Os.h>
+#include <Os_kernel.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/***********************************************************************************/
+/*  			    			    Macros				         				   */
+/***********************************************************************************/
+
+/* Largest number of ticks the expiries are counted over */
+#if (!defined OS_ALARM_PHASE_HORIZON)
+#define OS_ALARM_PHASE_HORIZON	(1000000UL)
+#endif /* #if (!defined OS_ALARM_PHASE_HORIZON) */
+
+/* Alarms of the self-test */
+#define PHASE_TEST_ALARMS		(3U)
+
+/* Alarms placed at once: the configured ones or the ones of the self-test */
+#if (ALARM_COUNT > PHASE_TEST_ALARMS)
+#define PHASE_ALARMS			(ALARM_COUNT)
+#else
+#define PHASE_ALARMS			(PHASE_TEST_ALARMS)
+#endif /* #if (ALARM_COUNT > PHASE_TEST_ALARMS) */
+
+/***********************************************************************************/
+/*                              Internal Types                                     */
+/***********************************************************************************/
+
+/* Alarm of the self-test, unplaced at its cycle */
+typedef struct
+{
+	uint32 Cycle;
+	uint32 Earliest;
+	uint32 Latest;
+	uint32 Placed;
+} PhaseTestAlarm;
+
+/***********************************************************************************/
+/*                              Internal Global Variables                          */
+/***********************************************************************************/
+
+/* Cycles of the alarms */
+static uint32 PhaseCycle[PHASE_ALARMS];
+
+/* Offsets of the alarms before the placement */
+static uint32 PhaseUnplaced[PHASE_ALARMS];
+
+/* Window of the first expiry of the alarms, set by an argument or from the unplaced offset */
+static uint32 PhaseEarliest[PHASE_ALARMS];
+static uint32 PhaseLatest[PHASE_ALARMS];
+static boolean PhaseWindowSet[PHASE_ALARMS];
+
+/* Offsets placed by the tool */
+static uint32 PhaseOffset[PHASE_ALARMS];
+
+/* Self-test: cycles 5 and 10 released together every 10 ticks */
+static const PhaseTestAlarm PhaseTestFree[2] =
+{
+	{  5U,  5U,  9U,  5U },
+	{ 10U, 10U, 19U, 11U }
+};
+
+/* Self-test: the same and a cycle 10 pinned at 12, placed first */
+static const PhaseTestAlarm PhaseTestPinned[PHASE_TEST_ALARMS] =
+{
+	{  5U,  5U,  9U,  5U },
+	{ 10U, 10U, 19U, 11U },
+	{ 10U, 12U, 12U, 12U }
+};
+
+/* Expiries per tick of the hyperperiod */
+static uint16 *PhaseLoad;
+
+/***********************************************************************************/
+/*				    	 Internal Functions Definition		      				   */
+/***********************************************************************************/
+
+static uint32 PhaseGcd(uint32 A, uint32 B)
+{
+	uint32 Rest;
+
+	while (0U != B)
+	{
+		Rest = A % B;
+		A    = B;
+		B    = Rest;
+	}
+
+	return A;
+}
+
+/* Least common multiple of the cycles, OS_ALARM_PHASE_HORIZON if larger */
+static uint32 PhaseHyperperiod(const AlarmType *Set, uint32 Count)
+{
+	uint64 Period = 1U;
+	uint32 Cycle;
+	uint32 Index;
+
+	for (Index = 0U; Index < Count; Index++)
+	{
+		Cycle  = PhaseCycle[Set[Index]];
+		Period = (Period / PhaseGcd((uint32)Period, Cycle)) * Cycle;
+
+		if (Period > OS_ALARM_PHASE_HORIZON)
+		{
+			return (uint32)OS_ALARM_PHASE_HORIZON;
+		}
+	}
+
+	return (uint32)Period;
+}
+
+/* The expiries of <Alarm> release a task */
+static boolean PhaseReleases(AlarmType Alarm)
+{
+	return ((ALARM_ACTIVATE_TASK == Alarms[Alarm].OsAlarmActionType) ||
+	        (ALARM_SET_EVENT == Alarms[Alarm].OsAlarmActionType)) ? TRUE : FALSE;
+}
+
+/* Adds the expiries of an alarm started at <Offset> to the load: the ticks of the
+   hyperperiod congruent to <Offset> modulo the cycle */
+static void PhaseAdd(uint32 Period, uint32 Offset, uint32 Cycle)
+{
+	uint32 Tick;
+
+	for (Tick = Offset % Cycle; Tick < Period; Tick += Cycle)
+	{
+		PhaseLoad[Tick]++;
+	}
+}
+
+/* Largest load met by an alarm started at <Offset>, and the sum of the loads met */
+static uint32 PhaseCost(uint32 Period, uint32 Offset, uint32 Cycle, uint32 *Met)
+{
+	uint32 Peak = 0U;
+	uint32 Tick;
+
+	*Met = 0U;
+
+	for (Tick = Offset % Cycle; Tick < Period; Tick += Cycle)
+	{
+		Peak  = (PhaseLoad[Tick] > Peak) ? PhaseLoad[Tick] : Peak;
+		*Met += PhaseLoad[Tick];
+	}
+
+	return Peak;
+}
+
+static uint32 PhasePeak(uint32 Period)
+{
+	uint32 Peak = 0U;
+	uint32 Tick;
+
+	for (Tick = 0U; Tick < Period; Tick++)
+	{
+		Peak = (PhaseLoad[Tick] > Peak) ? PhaseLoad[Tick] : Peak;
+	}
+
+	return Peak;
+}
+
+/* Placing order: pinned alarms, then shorter cycles, then the alarm ID */
+static int PhaseCompare(const void *Left, const void *Right)
+{
+	AlarmType A = *(const AlarmType *)Left;
+	AlarmType B = *(const AlarmType *)Right;
+	boolean PinnedA = (PhaseLatest[A] == PhaseEarliest[A]) ? TRUE : FALSE;
+	boolean PinnedB = (PhaseLatest[B] == PhaseEarliest[B]) ? TRUE : FALSE;
+
+	if (PinnedA != PinnedB)
+	{
+		return (TRUE == PinnedA) ? -1 : 1;
+	}
+
+	if (PhaseCycle[A] != PhaseCycle[B])
+	{
+		return (PhaseCycle[A] < PhaseCycle[B]) ? -1 : 1;
+	}
+
+	return (A < B) ? -1 : 1;
+}
+
+/* Places the alarms of <Set>, returns the peak before and after */
+static void PhasePlace(AlarmType *Set, uint32 Count, uint32 Period, uint32 *Before, uint32 *After)
+{
+	uint32 Index;
+	uint32 Offset;
+	uint32 Peak;
+	uint32 Met;
+	uint32 BestPeak;
+	uint32 BestMet;
+	uint32 Cycle;
+
+	(void)memset(PhaseLoad, 0, Period * sizeof(PhaseLoad[0]));
+
+	for (Index = 0U; Index < Count; Index++)
+	{
+		PhaseAdd(Period, PhaseUnplaced[Set[Index]], PhaseCycle[Set[Index]]);
+	}
+
+	*Before = PhasePeak(Period);
+
+	(void)memset(PhaseLoad, 0, Period * sizeof(PhaseLoad[0]));
+	qsort(Set, Count, sizeof(Set[0]), PhaseCompare);
+
+	for (Index = 0U; Index < Count; Index++)
+	{
+		Cycle    = PhaseCycle[Set[Index]];
+		BestPeak = 0xFFFFFFFFUL;
+		BestMet  = 0xFFFFFFFFUL;
+
+		for (Offset = PhaseEarliest[Set[Index]]; Offset <= PhaseLatest[Set[Index]]; Offset++)
+		{
+			Peak = PhaseCost(Period, Offset, Cycle, &Met);
+
+			if ((Peak < BestPeak) || ((Peak == BestPeak) && (Met < BestMet)))
+			{
+				BestPeak = Peak;
+				BestMet  = Met;
+				PhaseOffset[Set[Index]] = Offset;
+			}
+
+			/* The phases repeat after a cycle */
+			if ((Offset - PhaseEarliest[Set[Index]]) >= (Cycle - 1U))
+			{
+				break;
+			}
+		}
+
+		PhaseAdd(Period, PhaseOffset[Set[Index]], Cycle);
+	}
+
+	*After = PhasePeak(Period);
+
+	/* The unplaced offsets out of their window are not kept */
+	for (Index = 0U; Index < Count; Index++)
+	{
+		if ((PhaseUnplaced[Set[Index]] < PhaseEarliest[Set[Index]]) ||
+		    (PhaseUnplaced[Set[Index]] > PhaseLatest[Set[Index]]))
+		{
+			break;
+		}
+	}
+
+	if ((Index == Count) && (*After >= *Before))
+	{
+		/* No gain: the unplaced offsets are kept */
+		for (Index = 0U; Index < Count; Index++)
+		{
+			PhaseOffset[Set[Index]] = PhaseUnplaced[Set[Index]];
+		}
+
+		*After = *Before;
+	}
+}
+
+/* Places the alarms of <Test>, checks the peaks and the offsets */
+static int PhaseTest(const char *Name, const PhaseTestAlarm *Test, uint32 Count, uint32 ExpectedBefore, uint32 ExpectedAfter)
+{
+	AlarmType Set[PHASE_TEST_ALARMS];
+	uint32 Before;
+	uint32 After;
+	uint32 Index;
+	int Failures = 0;
+
+	for (Index = 0U; Index < Count; Index++)
+	{
+		Set[Index]           = (AlarmType)Index;
+		PhaseCycle[Index]    = Test[Index].Cycle;
+		PhaseUnplaced[Index] = Test[Index].Cycle;
+		PhaseEarliest[Index] = Test[Index].Earliest;
+		PhaseLatest[Index]   = Test[Index].Latest;
+	}
+
+	PhasePlace(Set, Count, PhaseHyperperiod(Set, Count), &Before, &After);
+
+	(void)printf("Self-test, %s: peak releases per tick %u before, %u after (%u, %u expected), offsets",
+	             Name, Before, After, ExpectedBefore, ExpectedAfter);
+
+	for (Index = 0U; Index < Count; Index++)
+	{
+		(void)printf(" %u", PhaseOffset[Index]);
+
+		if (PhaseOffset[Index] != Test[Index].Placed)
+		{
+			Failures++;
+		}
+	}
+
+	(void)printf("\n");
+
+	return ((0 == Failures) && (ExpectedBefore == Before) && (ExpectedAfter == After)) ? 0 : 1;
+}
+
+/* <AlarmID>:<Time> or <AlarmID>:<Earliest>:<Latest> */
+static int PhaseConstraint(const char *Argument)
+{
+	unsigned int Alarm;
+	unsigned int Earliest;
+	unsigned int Latest;
+	int Fields = sscanf(Argument, "%u:%u:%u", &Alarm, &Earliest, &Latest);
+
+	if (2 == Fields)
+	{
+		Latest = Earliest;
+	}
+
+	if ((Fields < 2) || (Alarm >= ALARM_COUNT) || (0U == Earliest) || (Earliest > Latest) ||
+	    (Latest > (unsigned int)Alarms[Alarm].OsAlarmCounterRef->OsCounterMaxAllowedValue))
+	{
+		(void)fprintf(stderr, "Invalid constraint %s: <AlarmID>:<Time> or <AlarmID>:<Earliest>:<Latest>, 0 < Earliest <= Latest <= OsCounterMaxAllowedValue\n", Argument);
+		return 1;
+	}
+
+	if (2 == Fields)
+	{
+		PhaseUnplaced[Alarm] = Earliest;
+	}
+	else
+	{
+		PhaseEarliest[Alarm]  = Earliest;
+		PhaseLatest[Alarm]    = Latest;
+		PhaseWindowSet[Alarm] = TRUE;
+	}
+
+	return 0;
+}
+
+/***********************************************************************************/
+/*				    	 External Functions Definition		      				   */
+/***********************************************************************************/
+
+/* Task bodies of the generated configuration, never started */
+TASK(Task0)
+{
+	TerminateTask();
+}
+
+TASK(Task1)
+{
+	TerminateTask();
+}
+
+int main(int argc, char *argv[])
+{
+	AlarmType Set[ALARM_COUNT];
+	uint32 Count;
+	uint32 Period;
+	uint32 Before;
+	uint32 After;
+	uint32 Mode;
+	uint32 Counter;
+	uint32 Index;
+	AlarmType Alarm;
+	int Argument;
+	int Failures = 0;
+
+	PhaseLoad = malloc((size_t)OS_ALARM_PHASE_HORIZON * sizeof(PhaseLoad[0]));
+
+	if (NULL == PhaseLoad)
+	{
+		return EXIT_FAILURE;
+	}
+
+	Failures += PhaseTest("cycles 5 and 10", PhaseTestFree, 2U, 2U, 1U);
+	Failures += PhaseTest("cycles 5 and 10, 10 pinned at 12", PhaseTestPinned, PHASE_TEST_ALARMS, 3U, 1U);
+
+	if (0 != Failures)
+	{
+		free(PhaseLoad);
+		return EXIT_FAILURE;
+	}
+
+	/* The configured alarms */
+	for (Index = 0U; Index < ALARM_COUNT; Index++)
+	{
+		PhaseCycle[Index]    = (uint32)Alarms[Index].OsAlarmCycleTime;
+		PhaseUnplaced[Index] = PhaseCycle[Index];
+	}
+
+	for (Argument = 1; Argument < argc; Argument++)
+	{
+		if (0 != PhaseConstraint(argv[Argument]))
+		{
+			free(PhaseLoad);
+			return EXIT_FAILURE;
+		}
+	}
+
+	for (Index = 0U; Index < ALARM_COUNT; Index++)
+	{
+		if (FALSE == PhaseWindowSet[Index])
+		{
+			PhaseEarliest[Index] = PhaseUnplaced[Index];
+			PhaseLatest[Index]   = PhaseEarliest[Index] + PhaseCycle[Index] - 1U;
+
+			if (PhaseLatest[Index] > (uint32)Alarms[Index].OsAlarmCounterRef->OsCounterMaxAllowedValue)
+			{
+				PhaseLatest[Index] = (uint32)Alarms[Index].OsAlarmCounterRef->OsCounterMaxAllowedValue;
+			}
+		}
+	}
+
+	for (Mode = 0U; Mode < MAX_NO_APPMODES; Mode++)
+	{
+		for (Counter = 0U; Counter < COUNTER_COUNT; Counter++)
+		{
+			/* The cyclic autostart alarms of the counter releasing a task, a single alarm
+			   expires once */
+			Count = 0U;
+
+			for (Index = 0U; Index < ApplicationModes[Mode].AutoStartAlarmsSize; Index++)
+			{
+				Alarm = ApplicationModes[Mode].AutoStartAlarms[Index];
+
+				if ((&Counters[Counter] == Alarms[Alarm].OsAlarmCounterRef) && (0U != Alarms[Alarm].OsAlarmCycleTime) &&
+				    (TRUE == PhaseReleases(Alarm)))
+				{
+					Set[Count] = Alarm;
+					Count++;
+				}
+			}
+
+			if (0U == Count)
+			{
+				continue;
+			}
+
+			Period = PhaseHyperperiod(Set, Count);
+
+			PhasePlace(Set, Count, Period, &Before, &After);
+
+			(void)printf("Application mode %u, Counter%u: %u cyclic autostart alarms releasing a task, hyperperiod %u ticks\n",
+			             Mode, Counter, Count, Period);
+
+			for (Index = 0U; Index < Count; Index++)
+			{
+				Alarm = Set[Index];
+
+				(void)printf("  Alarm%u: cycle %6u, window [%6u, %6u], OsAlarmAlarmTime %6u -> %6u (configured %u)\n",
+				             (uint32)Alarm, (uint32)Alarms[Alarm].OsAlarmCycleTime, PhaseEarliest[Alarm],
+				             PhaseLatest[Alarm], PhaseUnplaced[Alarm], PhaseOffset[Alarm],
+				             (uint32)Alarms[Alarm].OsAlarmAlarmTime);
+			}
+
+			(void)printf("  Peak releases per tick: %u before, %u after\n", Before, After);
+		}
+	}
+
+	free(PhaseLoad);
+
+	return EXIT_SUCCESS;
+}
+
+/***********************************************************************************/
+/*				    			 End Of File			         				   */
+/***********************************************************************************/
@@ -0,0 +1,719 @@
+/**
+ * @file Os_kernel_posix.c
+ * @author Mahmoud Ismail
+ * @version 1.0.0
+ * @date 19-10-2026
+ * @platform x86-64 Linux (host simulation)
+ * @brief This files contains the POSIX host dependent code for OS kernel.
+ *
+ * Mapping of the Cortex-M mechanisms on the host:
+ *  - PSP task stacks + exception frames  -> ucontext per task on a host stack
+ *  - SysTick                             -> ITIMER_REAL / SIGALRM
+ *  - SVC + CPSID I                       -> OS_PosixSystemCall() with the interrupt signals blocked
+ *  - wfi                                 -> sigsuspend()
+ *  - free-running compare timer          -> CLOCK_MONOTONIC and a one-shot ITIMER_REAL
+ *    (OS_COUNTER_COMPARE_TIMER), one count per OS_POSIX_TICK_PERIOD_US
+ *  - timers of the other hardware counters -> POSIX timers raising OS_POSIX_TIMER_SIGNAL(Channel)
+ *  - deferred expiry interrupt          -> raised by the tick signal handler after SysTick
+ *    (OS_TICK_DEFERRED), like the interrupt tail-chained on the target
+ *
+ * With OS_POSIX_VIRTUAL_TIME == STD_ON the tick is raised by the virtual clock of
+ * Os_sim_posix.c instead of ITIMER_REAL.
+*/
+
+/*------------------------- MISRA-C vailoations in c files -----------------------*/
+
+
+
+/**********************************************************************************/
+/*                               INCLUDE HEADERS	                              */
+/**********************************************************************************/
+/* Include Kernel Header File */
+#include <Os_kernel.h>
+#include <Os_syscalls.h>
+#include <Os_kernel_intlock.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+
+
+/***********************************************************************************/
+/*                                  MACROS                                         */
+/***********************************************************************************/
+
+#if (OS_MPU_PROTECTION == STD_ON)
+#error The POSIX host port has no MPU, OS_MPU_PROTECTION must be STD_OFF
+#endif /* #if (OS_MPU_PROTECTION == STD_ON) */
+
+
+/************************************************************************************/
+/*                                 TypeDefnitions                                   */
+/************************************************************************************/
+
+/***********************************************************************************/
+/*				    	  External data	shared global varaibles	         	       */
+/***********************************************************************************/
+
+/* Pointer to the previous task */
+Os_Task *PTask;
+
+/***********************************************************************************/
+/*                              Internal Global Variables                          */
+/***********************************************************************************/
+
+/* Host stacks of the tasks, indexed by the task ID */
+static uint8 Os_PosixStacks[TASK_COUNT][OS_POSIX_STACK_SIZE] __attribute__((aligned(16)));
+
+/* Contexts of the tasks, linked to Os_TaskDynamic.Context on first use */
+static Os_ContexType Os_PosixContexts[TASK_COUNT];
+
+/* Set of the signals emulating the interrupts of the target */
+static sigset_t Os_PosixInterruptMask;
+
+#if (OS_TICKLESS_IDLE == STD_ON)
+/* Ticks programmed by the last Os_TicklessSleep and host time of the tick ending it */
+static uint32 Os_PosixTicklessTicks;
+static Os_SimTimeType Os_PosixTicklessEnd;
+#endif /* #if (OS_TICKLESS_IDLE == STD_ON) */
+
+#if (OS_COUNTER_COMPARE_TIMER == STD_ON)
+/* Host time of the timer value 0 and start state of the stand-in timer */
+static Os_SimTimeType Os_PosixTimerBase;
+static boolean Os_PosixTimerStarted = FALSE;
+#endif /* #if (OS_COUNTER_COMPARE_TIMER == STD_ON) */
+
+#if (OS_TICK_DEFERRED == STD_ON)
+/* The deferred expiry handler is pended by SysTick */
+static boolean Os_PosixDeferredPending = FALSE;
+#endif /* #if (OS_TICK_DEFERRED == STD_ON) */
+
+#if (OS_POSIX_VIRTUAL_TIME == STD_OFF)
+/* Drivers of the simulated timers started and their POSIX timers */
+static const Os_CounterDriver *Os_PosixTimers[OS_POSIX_TIMER_COUNT];
+static timer_t Os_PosixTimerIds[OS_POSIX_TIMER_COUNT];
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_OFF) */
+
+/* Signal mask saved by DisableAll */
+static sigset_t Os_PosixDisableAllMask;
+
+/* Signal masks saved by the outermost SuspendAll / SuspendOS and their nesting */
+static sigset_t Os_PosixSuspendAllMask;
+static sigset_t Os_PosixSuspendOsMask;
+static uint8 Os_PosixSuspendAllNesting;
+static uint8 Os_PosixSuspendOsNesting;
+
+/***********************************************************************************/
+/*                        Internal Function Declration                             */
+/***********************************************************************************/
+
+static P2VAR(Os_ContexType, AUTOMATIC, OS_VAR) Os_PosixGetContext(P2VAR(Os_Task, AUTOMATIC, OS_CONST) Task);
+
+#if (OS_POSIX_VIRTUAL_TIME == STD_OFF)
+static void Os_PosixTickHandler(int Signal);
+
+static void Os_PosixTimerHandler(int Signal);
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_OFF) */
+
+#if ((OS_COUNTER_COMPARE_TIMER == STD_ON) || (OS_TICKLESS_IDLE == STD_ON))
+static Os_SimTimeType Os_PosixTimerNow(void);
+#endif /* #if ((OS_COUNTER_COMPARE_TIMER == STD_ON) || (OS_TICKLESS_IDLE == STD_ON)) */
+
+/***********************************************************************************/
+/*				    	 External Functions Definition		      				   */
+/***********************************************************************************/
+
+void OS_StartTask(void *PrevTask)
+{
+	/* Set the previous task */
+	PTask = (Os_Task *) PrevTask;
+
+	/* Create the stack frame for the task */
+	Os_CreateStackFrame();
+
+	/* Dispatch the task */
+	OS_DISPATCH();
+}
+
+void OS_ResumeTask(void *PrevTask)
+{
+	/* Set the previous task */
+	PTask = (Os_Task *) PrevTask;
+
+	/* Dispatch the task */
+	OS_DISPATCH();
+}
+
+/**
+ * @brief Creates the initial context of the running task.
+ *
+ * The context starts at the task entry point on the host stack of the task with all
+ * emulated interrupts enabled, like the initial xPSR/EXC_RETURN frame on the target.
+ */
+void Os_CreateStackFrame(void)
+{
+	P2VAR(Os_ContexType, AUTOMATIC, OS_VAR) TaskContext = Os_PosixGetContext(Kernel.TaskRunning);
+
+	(void)getcontext(&TaskContext->Context);
+
+	TaskContext->Context.uc_stack.ss_sp   = Os_PosixStacks[Kernel.TaskRunning->TaskID];
+	TaskContext->Context.uc_stack.ss_size = OS_POSIX_STACK_SIZE;
+	TaskContext->Context.uc_link          = NULL_PTR;
+
+	/* Tasks start with interrupts enabled */
+	(void)sigemptyset(&TaskContext->Context.uc_sigmask);
+
+	makecontext(&TaskContext->Context, Kernel.TaskRunning->EntryPoint, 0);
+}
+
+/**
+ * @brief Saves the context of the preempted task and restores the running one.
+ *
+ * Same contract as SaveAndSwitchContext in Systemcall.asm: the context is saved into
+ * Kernel.TaskPreempted (if any) and Kernel.TaskRunning is resumed. The call returns
+ * when the saved task is dispatched again.
+ */
+void SaveAndSwitchContext(void)
+{
+	P2VAR(Os_Task, AUTOMATIC, OS_CONST) Previous = Kernel.TaskPreempted;
+	P2VAR(Os_Task, AUTOMATIC, OS_CONST) Next     = Kernel.TaskRunning;
+
+#if (OS_POSIX_VIRTUAL_TIME == STD_ON)
+	OS_SimDispatch();
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_ON) */
+
+	if (Previous == Next)
+	{
+		/* Nothing to switch */
+	}
+	else if (NULL_PTR == Previous)
+	{
+		/* The previous task terminated, its context is not kept */
+		(void)setcontext(&Os_PosixGetContext(Next)->Context);
+	}
+	else
+	{
+		(void)swapcontext(&Os_PosixGetContext(Previous)->Context, &Os_PosixGetContext(Next)->Context);
+	}
+}
+
+void NewTaskStackInit(int Source)
+{
+	(void)Source;
+
+	Os_CreateStackFrame();
+
+	SaveAndSwitchContext();
+}
+
+unsigned char OS_PosixSystemCall(unsigned char ServiceId, unsigned long Arg0, unsigned long Arg1, unsigned long Arg2)
+{
+	VAR(StatusType, AUTOMATIC) ReturnStatus = E_OS_ID;
+	sigset_t PreviousMask;
+
+	/* CPSID I */
+	OS_PosixDisableInterrupts(&PreviousMask);
+
+	if ((ServiceId < OS_N_SYSCALL) && (NULL_PTR != OS_syscallTable[ServiceId]))
+	{
+		ReturnStatus = ((Os_PosixSyscallPtrType)OS_syscallTable[ServiceId])(Arg0, Arg1, Arg2);
+
+		/* Called from a Category 2 ISR: the rescheduling is done by the ISR exit */
+		if (0U == Kernel.IsrNestingLevel)
+		{
+			OS_PosixDispatch();
+		}
+	}
+
+#if (OS_POSIX_VIRTUAL_TIME == STD_ON)
+	OS_SimTrace();
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_ON) */
+
+	/* CPSIE I, executed by the calling task once it is dispatched again */
+	OS_PosixRestoreInterrupts(&PreviousMask);
+
+	return ReturnStatus;
+}
+
+void OS_PosixDispatch(void)
+{
+	if (TRUE == Kernel.SchedulerNeeded)
+	{
+		Kern_Schedule();
+
+		if (FALSE == Kernel.DispatcherNeeded)
+		{
+			/* Do Nothing */
+		}
+		else if (TRUE == Kernel.NewContext)
+		{
+			NewTaskStackInit(0);
+		}
+		else
+		{
+			SaveAndSwitchContext();
+		}
+	}
+}
+
+void OS_PosixDisableInterrupts(sigset_t *PreviousMask)
+{
+	(void)sigprocmask(SIG_BLOCK, &Os_PosixInterruptMask, PreviousMask);
+}
+
+void OS_PosixRestoreInterrupts(const sigset_t *PreviousMask)
+{
+	(void)sigprocmask(SIG_SETMASK, PreviousMask, NULL_PTR);
+}
+
+/*
+	Interrupt lock services (Os_kernel_intlock.h). The host has a single interrupt
+	level, SuspendOS and SuspendAll both block the interrupt signals.
+*/
+FUNC(void, OS_CODE) OS_DisableAllInterrupts(P2VAR(Os_IntLockSiteType, AUTOMATIC, OS_VAR) Site)
+{
+	/* The mask of an emulated ISR stays blocked on the enable */
+	OS_PosixDisableInterrupts(&Os_PosixDisableAllMask);
+
+#if (OS_INT_LOCK_MEASURE == STD_ON)
+	OS_IntLockMeasureStart(OS_INT_LOCK_ALL, Site);
+#else
+	(void)Site;
+#endif /* #if (OS_INT_LOCK_MEASURE == STD_ON) */
+}
+
+FUNC(void, OS_CODE) OS_EnableAllInterrupts(void)
+{
+#if (OS_INT_LOCK_MEASURE == STD_ON)
+	OS_IntLockMeasureStop(OS_INT_LOCK_ALL);
+#endif /* #if (OS_INT_LOCK_MEASURE == STD_ON) */
+
+	OS_PosixRestoreInterrupts(&Os_PosixDisableAllMask);
+}
+
+FUNC(void, OS_CODE) OS_SuspendAllInterrupts(P2VAR(Os_IntLockSiteType, AUTOMATIC, OS_VAR) Site)
+{
+	sigset_t PreviousMask;
+
+	OS_PosixDisableInterrupts(&PreviousMask);
+
+	if (0U == Os_PosixSuspendAllNesting)
+	{
+		Os_PosixSuspendAllMask = PreviousMask;
+
+#if (OS_INT_LOCK_MEASURE == STD_ON)
+		OS_IntLockMeasureStart(OS_INT_LOCK_SUSPEND_ALL, Site);
+#endif /* #if (OS_INT_LOCK_MEASURE == STD_ON) */
+	}
+#if (OS_INT_LOCK_MEASURE == STD_OFF)
+	(void)Site;
+#endif /* #if (OS_INT_LOCK_MEASURE == STD_OFF) */
+
+	Os_PosixSuspendAllNesting++;
+}
+
+FUNC(void, OS_CODE) OS_ResumeAllInterrupts(void)
+{
+	/* A resume without suspend is ignored */
+	if (0U != Os_PosixSuspendAllNesting)
+	{
+		Os_PosixSuspendAllNesting--;
+
+		if (0U == Os_PosixSuspendAllNesting)
+		{
+#if (OS_INT_LOCK_MEASURE == STD_ON)
+			OS_IntLockMeasureStop(OS_INT_LOCK_SUSPEND_ALL);
+#endif /* #if (OS_INT_LOCK_MEASURE == STD_ON) */
+
+			OS_PosixRestoreInterrupts(&Os_PosixSuspendAllMask);
+		}
+	}
+}
+
+FUNC(void, OS_CODE) OS_SuspendOSInterrupts(P2VAR(Os_IntLockSiteType, AUTOMATIC, OS_VAR) Site)
+{
+	sigset_t PreviousMask;
+
+	OS_PosixDisableInterrupts(&PreviousMask);
+
+	if (0U == Os_PosixSuspendOsNesting)
+	{
+		Os_PosixSuspendOsMask = PreviousMask;
+
+#if (OS_INT_LOCK_MEASURE == STD_ON)
+		OS_IntLockMeasureStart(OS_INT_LOCK_SUSPEND_OS, Site);
+#endif /* #if (OS_INT_LOCK_MEASURE == STD_ON) */
+	}
+#if (OS_INT_LOCK_MEASURE == STD_OFF)
+	(void)Site;
+#endif /* #if (OS_INT_LOCK_MEASURE == STD_OFF) */
+
+	Os_PosixSuspendOsNesting++;
+}
+
+FUNC(void, OS_CODE) OS_ResumeOSInterrupts(void)
+{
+	/* A resume without suspend is ignored */
+	if (0U != Os_PosixSuspendOsNesting)
+	{
+		Os_PosixSuspendOsNesting--;
+
+		if (0U == Os_PosixSuspendOsNesting)
+		{
+#if (OS_INT_LOCK_MEASURE == STD_ON)
+			OS_IntLockMeasureStop(OS_INT_LOCK_SUSPEND_OS);
+#endif /* #if (OS_INT_LOCK_MEASURE == STD_ON) */
+
+			OS_PosixRestoreInterrupts(&Os_PosixSuspendOsMask);
+		}
+	}
+}
+
+/* The host tasks are not restricted, nothing to elevate */
+FUNC(StatusType, OS_CODE) OS_SuspendInterrupts(CONST(uint8, AUTOMATIC) Kind)
+{
+	(void)Kind;
+
+	return E_OK;
+}
+
+#if (OS_TICKLESS_IDLE == STD_ON)
+
+uint32 Os_TicklessSleep(uint32 Ticks)
+{
+#if (OS_POSIX_VIRTUAL_TIME == STD_ON)
+	Os_PosixTicklessEnd = OS_SimDelayTick(Ticks);
+#else
+	struct itimerval TickTimer;
+
+	/* Read before the timer is armed: the expiry is never before the end */
+	Os_PosixTicklessEnd = Os_PosixTimerNow() + ((Os_SimTimeType)Ticks * OS_POSIX_TICK_PERIOD_US);
+
+	/* First expiry after <Ticks> periods, periodic again afterwards */
+	TickTimer.it_interval.tv_sec  = 0;
+	TickTimer.it_interval.tv_usec = OS_POSIX_TICK_PERIOD_US;
+	TickTimer.it_value.tv_sec     = (time_t)(((uint64)Ticks * OS_POSIX_TICK_PERIOD_US) / 1000000U);
+	TickTimer.it_value.tv_usec    = (suseconds_t)(((uint64)Ticks * OS_POSIX_TICK_PERIOD_US) % 1000000U);
+	(void)setitimer(ITIMER_REAL, &TickTimer, NULL_PTR);
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_ON) */
+
+	Os_PosixTicklessTicks = Ticks;
+
+	return Ticks;
+}
+
+uint32 Os_TicklessWake(void)
+{
+	Os_SimTimeType Now = Os_PosixTimerNow();
+	Os_SimTimeType Ahead;
+	Os_SimTimeType Next;
+	uint32 Elapsed = Os_PosixTicklessTicks - 1U;
+#if (OS_POSIX_VIRTUAL_TIME == STD_OFF)
+	struct itimerval TickTimer;
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_OFF) */
+
+	if (Now >= Os_PosixTicklessEnd)
+	{
+		/* The sleep ended, the tick is pending and counts the last tick itself */
+	}
+	else
+	{
+		/* Woken up early by another ISR (a counter driver): count the boundaries passed,
+		   the ones ahead include the end of the sleep. The tick resumes on the next one */
+		Ahead   = ((Os_PosixTicklessEnd - Now) + OS_POSIX_TICK_PERIOD_US - 1U) / OS_POSIX_TICK_PERIOD_US;
+		Elapsed = Os_PosixTicklessTicks - (uint32)Ahead;
+		Next    = Os_PosixTicklessEnd - ((Ahead - 1U) * OS_POSIX_TICK_PERIOD_US);
+
+#if (OS_POSIX_VIRTUAL_TIME == STD_ON)
+		OS_SimSetCompare(Next);
+#else
+		TickTimer.it_interval.tv_sec  = 0;
+		TickTimer.it_interval.tv_usec = OS_POSIX_TICK_PERIOD_US;
+		TickTimer.it_value.tv_sec     = (time_t)((Next - Now) / 1000000U);
+		TickTimer.it_value.tv_usec    = (suseconds_t)((Next - Now) % 1000000U);
+		(void)setitimer(ITIMER_REAL, &TickTimer, NULL_PTR);
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_ON) */
+	}
+
+	return Elapsed;
+}
+
+#endif /* #if (OS_TICKLESS_IDLE == STD_ON) */
+
+#if (OS_COUNTER_COMPARE_TIMER == STD_ON)
+
+/*
+	Stand-in of the free-running compare timer: the host time in OS_POSIX_TICK_PERIOD_US
+	units, the compare is a one-shot timer (virtual time: the next interrupt of the clock).
+*/
+void Os_CounterTimerStart(void)
+{
+	/* A warm restart keeps the timer running */
+	if (FALSE == Os_PosixTimerStarted)
+	{
+		Os_PosixTimerBase    = Os_PosixTimerNow();
+		Os_PosixTimerStarted = TRUE;
+	}
+}
+
+uint32 Os_CounterTimerRead(void)
+{
+	return (uint32)((Os_PosixTimerNow() - Os_PosixTimerBase) / OS_POSIX_TICK_PERIOD_US);
+}
+
+void Os_CounterTimerSetCompare(uint32 Compare)
+{
+	Os_SimTimeType Now = Os_PosixTimerNow() - Os_PosixTimerBase;
+	uint32 Counts = Compare - (uint32)(Now / OS_POSIX_TICK_PERIOD_US);
+	Os_SimTimeType Delay;
+#if (OS_POSIX_VIRTUAL_TIME == STD_OFF)
+	struct itimerval CompareTimer;
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_OFF) */
+
+	/* A compare already passed is raised at once, the kernel catches up */
+	if (Counts > 0x80000000UL)
+	{
+		Counts = 0U;
+	}
+
+	/* Host time at which the timer reaches <Compare> */
+	Delay = ((((Now / OS_POSIX_TICK_PERIOD_US) + Counts) * OS_POSIX_TICK_PERIOD_US) + Os_PosixTimerBase) - Os_PosixTimerNow();
+
+#if (OS_POSIX_VIRTUAL_TIME == STD_ON)
+	OS_SimSetCompare(OS_SimGetTime() + Delay);
+#else
+	/* One-shot, a zero value would disarm the timer */
+	CompareTimer.it_interval.tv_sec  = 0;
+	CompareTimer.it_interval.tv_usec = 0;
+	CompareTimer.it_value.tv_sec     = (time_t)(Delay / 1000000U);
+	CompareTimer.it_value.tv_usec    = (suseconds_t)((0U == Delay) ? 1U : (Delay % 1000000U));
+	(void)setitimer(ITIMER_REAL, &CompareTimer, NULL_PTR);
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_ON) */
+}
+
+#endif /* #if (OS_COUNTER_COMPARE_TIMER == STD_ON) */
+
+#if (OS_TICK_DEFERRED == STD_ON)
+
+void Os_TickDeferredPend(void)
+{
+	Os_PosixDeferredPending = TRUE;
+}
+
+boolean OS_PosixDeferredTake(void)
+{
+	boolean Pending = Os_PosixDeferredPending;
+
+	Os_PosixDeferredPending = FALSE;
+
+	return Pending;
+}
+
+#endif /* #if (OS_TICK_DEFERRED == STD_ON) */
+
+void Os_PosixTimerStart(const Os_CounterDriver *Driver)
+{
+#if (OS_POSIX_VIRTUAL_TIME == STD_ON)
+	OS_SimTimerStart(Driver);
+#else
+	uint8 Channel = Driver->OsCounterDriverChannel;
+	struct sigevent Event;
+	struct itimerspec Period;
+
+	if (Channel < OS_POSIX_TIMER_COUNT)
+	{
+		/* A warm restart keeps the POSIX timer, it is armed again */
+		if (NULL_PTR == Os_PosixTimers[Channel])
+		{
+			(void)memset(&Event, 0, sizeof(Event));
+			Event.sigev_notify = SIGEV_SIGNAL;
+			Event.sigev_signo  = OS_POSIX_TIMER_SIGNAL(Channel);
+			(void)timer_create(CLOCK_MONOTONIC, &Event, &Os_PosixTimerIds[Channel]);
+		}
+
+		Os_PosixTimers[Channel] = Driver;
+
+		Period.it_interval.tv_sec  = (time_t)(Driver->OsCounterDriverPeriod / 1000000U);
+		Period.it_interval.tv_nsec = (long)((Driver->OsCounterDriverPeriod % 1000000U) * 1000U);
+		Period.it_value            = Period.it_interval;
+		(void)timer_settime(Os_PosixTimerIds[Channel], 0, &Period, NULL_PTR);
+	}
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_ON) */
+}
+
+void OS_PosixShutdown(void)
+{
+	(void)sigprocmask(SIG_BLOCK, &Os_PosixInterruptMask, NULL_PTR);
+	(void)fflush(stdout);
+
+	exit(EXIT_SUCCESS);
+}
+
+uint32 OS_PosixTimestamp(void)
+{
+#if (OS_POSIX_VIRTUAL_TIME == STD_ON)
+	return (uint32)OS_SimGetTime();
+#else
+	struct timespec Now;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &Now);
+
+	return (uint32)(((uint64)Now.tv_sec * 1000000U) + (uint64)(Now.tv_nsec / 1000));
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_ON) */
+}
+
+void OS_PosixStartTick(void)
+{
+	uint8 Channel;
+#if (OS_POSIX_VIRTUAL_TIME == STD_OFF)
+	struct sigaction TickAction;
+	struct itimerval TickTimer;
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_OFF) */
+
+	(void)sigemptyset(&Os_PosixInterruptMask);
+	(void)sigaddset(&Os_PosixInterruptMask, OS_POSIX_TICK_SIGNAL);
+	for (Channel = 0U; Channel < OS_POSIX_TIMER_COUNT; Channel++)
+	{
+		(void)sigaddset(&Os_PosixInterruptMask, OS_POSIX_TIMER_SIGNAL(Channel));
+	}
+
+#if (OS_POSIX_VIRTUAL_TIME == STD_OFF)
+	(void)memset(&TickAction, 0, sizeof(TickAction));
+	TickAction.sa_handler = Os_PosixTickHandler;
+	/* Interrupts do not nest: block the other interrupt signals during the handler */
+	TickAction.sa_mask    = Os_PosixInterruptMask;
+	TickAction.sa_flags   = SA_RESTART;
+	(void)sigaction(OS_POSIX_TICK_SIGNAL, &TickAction, NULL_PTR);
+
+	/* The simulated timers are started by StartOS, their interrupts do not nest either */
+	TickAction.sa_handler = Os_PosixTimerHandler;
+	for (Channel = 0U; Channel < OS_POSIX_TIMER_COUNT; Channel++)
+	{
+		(void)sigaction(OS_POSIX_TIMER_SIGNAL(Channel), &TickAction, NULL_PTR);
+	}
+
+#if (OS_COUNTER_COMPARE_TIMER == STD_ON)
+	/* No periodic tick, the compare is programmed by the kernel */
+	(void)TickTimer;
+#else
+	TickTimer.it_interval.tv_sec  = 0;
+	TickTimer.it_interval.tv_usec = OS_POSIX_TICK_PERIOD_US;
+	TickTimer.it_value            = TickTimer.it_interval;
+	(void)setitimer(ITIMER_REAL, &TickTimer, NULL_PTR);
+#endif /* #if (OS_COUNTER_COMPARE_TIMER == STD_ON) */
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_OFF) */
+}
+
+/**
+ * @brief Host idle function, the equivalent of the "wfi" loop of the Cortex-M port.
+ */
+void OS_CoretexIdle(void)
+{
+#if (OS_POSIX_VIRTUAL_TIME == STD_ON)
+	/* No signals in virtual time, the idle loop advances the clock itself */
+	OS_SimIdle();
+#else
+	sigset_t NoSignals;
+
+	(void)sigemptyset(&NoSignals);
+
+	while(1)
+	{
+		/* Sleep until the next emulated interrupt */
+		(void)sigsuspend(&NoSignals);
+	}
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_ON) */
+}
+
+void OS_PosixIdleWait(void)
+{
+#if (OS_POSIX_VIRTUAL_TIME == STD_ON)
+	OS_SimIdleWait();
+#else
+	sigset_t NoSignals;
+
+	(void)sigemptyset(&NoSignals);
+	(void)sigsuspend(&NoSignals);
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_ON) */
+}
+
+void OS_EnterKernel(void)
+{
+	(void)sigprocmask(SIG_BLOCK, &Os_PosixInterruptMask, NULL_PTR);
+}
+
+void OS_LeaveKernel(void)
+{
+	(void)sigprocmask(SIG_UNBLOCK, &Os_PosixInterruptMask, NULL_PTR);
+}
+
+
+/***********************************************************************************/
+/*				    	 Internal Functions Definition		      				   */
+/***********************************************************************************/
+
+static P2VAR(Os_ContexType, AUTOMATIC, OS_VAR) Os_PosixGetContext(P2VAR(Os_Task, AUTOMATIC, OS_CONST) Task)
+{
+	if (NULL_PTR == Task->TaskDynamics->Context)
+	{
+		Task->TaskDynamics->Context = &Os_PosixContexts[Task->TaskID];
+	}
+
+	return Task->TaskDynamics->Context;
+}
+
+#if (OS_POSIX_VIRTUAL_TIME == STD_OFF)
+static void Os_PosixTickHandler(int Signal)
+{
+	(void)Signal;
+
+#if (OS_COUNTER_COMPARE_TIMER == STD_ON)
+	CounterTimer_Handler();
+#elif (OS_TICK_DEFERRED == STD_ON)
+	SysTick_Handler();
+
+	/* SysTick has returned, the pended handler runs next */
+	if (TRUE == OS_PosixDeferredTake())
+	{
+		CounterTimer_Handler();
+	}
+#else
+	SysTick_Handler();
+#endif /* #if (OS_COUNTER_COMPARE_TIMER == STD_ON) */
+}
+
+static void Os_PosixTimerHandler(int Signal)
+{
+	const Os_CounterDriver *Driver = Os_PosixTimers[Signal - OS_POSIX_TIMER_SIGNAL(0U)];
+
+	if (NULL_PTR != Driver)
+	{
+		Driver->OsCounterDriverIsr();
+	}
+}
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_OFF) */
+
+#if ((OS_COUNTER_COMPARE_TIMER == STD_ON) || (OS_TICKLESS_IDLE == STD_ON))
+/**
+ * @brief Time in microseconds of the stand-in timer and of the tickless sleep, the virtual
+ * clock in virtual time mode.
+ */
+static Os_SimTimeType Os_PosixTimerNow(void)
+{
+#if (OS_POSIX_VIRTUAL_TIME == STD_ON)
+	return OS_SimGetTime();
+#else
+	struct timespec Now;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &Now);
+
+	return ((Os_SimTimeType)Now.tv_sec * 1000000U) + (Os_SimTimeType)(Now.tv_nsec / 1000);
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_ON) */
+}
+#endif /* #if ((OS_COUNTER_COMPARE_TIMER == STD_ON) || (OS_TICKLESS_IDLE == STD_ON)) */
+
+/***********************************************************************************/
+/*				    			 End Of File			         				   */
+/***********************************************************************************/
@@ -0,0 +1,478 @@
+/**
+ * @file Os_sim_posix.c
+ * @author Mahmoud Ismail
+ * @version 1.0.0
+ * @date 19-10-2026
+ * @platform x86-64 Linux (host simulation)
+ * @brief Deterministic virtual time mode of the POSIX host port.
+ *
+ * The virtual clock counts microseconds. It is advanced by OS_SimExecute() on behalf of
+ * the running task and by OS_SimIdle() up to the next tick, every tick boundary crossed
+ * raises SysTick_Handler() synchronously (OS_COUNTER_COMPARE_TIMER: the clock runs to the
+ * next compare and raises CounterTimer_Handler(); OS_TICK_DEFERRED: SysTick_Handler() then the
+ * deferred CounterTimer_Handler() when pended). The simulated timers of the other hardware
+ * counters raise the tick ISR of their counter every period of their driver. Job activations and completions are observed
+ * on Os_TaskDynamic.PendingActivationRequests after every kernel call, which needs no
+ * change of the kernel sources.
+*/
+
+/*------------------------- MISRA-C vailoations in c files -----------------------*/
+
+
+
+/**********************************************************************************/
+/*                               INCLUDE HEADERS	                              */
+/**********************************************************************************/
+/* Include Kernel Header File */
+#include <Os_kernel.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/***********************************************************************************/
+/*                                  MACROS                                         */
+/***********************************************************************************/
+
+/* End of the simulation */
+#define OS_SIM_END_TIME     ((Os_SimTimeType)OS_POSIX_SIM_TICKS * OS_POSIX_TICK_PERIOD_US)
+
+
+/************************************************************************************/
+/*                                 TypeDefnitions                                   */
+/************************************************************************************/
+
+#if (OS_POSIX_VIRTUAL_TIME == STD_ON)
+
+/**
+ * @brief Statistics of a task collected by the simulation.
+ */
+typedef struct
+{
+	/*! Activation times of the pending jobs, oldest first */
+	Os_SimTimeType ActivationTime[OS_POSIX_SIM_MAX_ACTIVATIONS];
+	/*! Number of pending activations seen at the last kernel call */
+	uint8          Pending;
+	/*! Number of activations */
+	uint32         Activations;
+	/*! Number of completed jobs */
+	uint32         Completions;
+	/*! Number of dispatches of the task */
+	uint32         Dispatches;
+	/*! Virtual time spent running the task */
+	Os_SimTimeType ExecutionTime;
+	/*! Best, worst and summed response time of the completed jobs */
+	Os_SimTimeType BestResponse;
+	Os_SimTimeType WorstResponse;
+	Os_SimTimeType TotalResponse;
+} Os_SimTaskStatsType;
+
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_ON) */
+
+/***********************************************************************************/
+/*                              Internal Global Variables                          */
+/***********************************************************************************/
+
+#if (OS_POSIX_VIRTUAL_TIME == STD_ON)
+
+/* Current virtual time */
+static Os_SimTimeType Os_SimNow = 0;
+
+/* Virtual time of the next tick, with OS_COUNTER_COMPARE_TIMER of the next compare
+   interrupt or the end of the simulation */
+#if (OS_COUNTER_COMPARE_TIMER == STD_ON)
+static Os_SimTimeType Os_SimNextTick = OS_SIM_END_TIME;
+#else
+static Os_SimTimeType Os_SimNextTick = OS_POSIX_TICK_PERIOD_US;
+#endif /* #if (OS_COUNTER_COMPARE_TIMER == STD_ON) */
+
+/* Tick interrupts raised, each one wakes the core up from idle */
+static uint32 Os_SimTickInterrupts = 0;
+
+#if (OS_TICK_DEFERRED == STD_ON)
+/* Deferred expiry interrupts pended by SysTick */
+static uint32 Os_SimDeferredInterrupts = 0;
+#endif /* #if (OS_TICK_DEFERRED == STD_ON) */
+
+/* Drivers of the simulated timers started, virtual time of their next interrupt and
+   interrupts raised, indexed by the channel */
+static const Os_CounterDriver *Os_SimTimers[OS_POSIX_TIMER_COUNT];
+static Os_SimTimeType Os_SimTimerNext[OS_POSIX_TIMER_COUNT];
+static uint32 Os_SimTimerInterrupts[OS_POSIX_TIMER_COUNT];
+
+/* Task dispatched last */
+static P2VAR(Os_Task, AUTOMATIC, OS_CONST) Os_SimLastDispatched = NULL_PTR;
+
+/* The dispatcher sleeps in idle, no task is running (OS_CONTEXTLESS_IDLE) */
+static boolean Os_SimIdleWaiting = FALSE;
+
+/* Statistics of the tasks, indexed by the task ID. The idle time is kept at IdleTaskId,
+   also without an idle task */
+static Os_SimTaskStatsType Os_SimTaskStats[IdleTaskId + 1];
+
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_ON) */
+
+/***********************************************************************************/
+/*                        Internal Function Declration                             */
+/***********************************************************************************/
+
+#if (OS_POSIX_VIRTUAL_TIME == STD_ON)
+
+static void Os_SimAdvance(Os_SimTimeType Duration);
+
+static Os_SimTimeType Os_SimNextEvent(void);
+
+static void Os_SimInterrupt(void);
+
+static void Os_SimTick(void);
+
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_ON) */
+
+/***********************************************************************************/
+/*				    	 External Functions Definition		      				   */
+/***********************************************************************************/
+
+#if (OS_POSIX_VIRTUAL_TIME == STD_ON)
+
+void OS_SimExecute(uint32 Cost)
+{
+	Os_SimAdvance((Os_SimTimeType)Cost);
+}
+
+Os_SimTimeType OS_SimGetTime(void)
+{
+	return Os_SimNow;
+}
+
+void OS_SimIdle(void)
+{
+	while(1)
+	{
+		/* Nothing is ready before the next interrupt */
+		Os_SimAdvance(Os_SimNextEvent() - Os_SimNow);
+	}
+}
+
+void OS_SimIdleWait(void)
+{
+	OS_SimTrace();
+
+	if (FALSE == Os_SimIdleWaiting)
+	{
+#if (OS_POSIX_SIM_TRACE == STD_ON)
+		(void)printf("%10llu us: idle\n", (unsigned long long)Os_SimNow);
+#endif /* #if (OS_POSIX_SIM_TRACE == STD_ON) */
+		Os_SimTaskStats[IdleTaskId].Dispatches++;
+		Os_SimIdleWaiting = TRUE;
+	}
+
+	/* Kernel.TaskRunning is NULL_PTR, the time is idle time */
+	Os_SimAdvance(Os_SimNextEvent() - Os_SimNow);
+}
+
+void OS_SimTrace(void)
+{
+	VAR(TaskType, AUTOMATIC) TaskID;
+	P2VAR(Os_SimTaskStatsType, AUTOMATIC, OS_VAR) Stats;
+	VAR(Os_SimTimeType, AUTOMATIC) Response;
+	VAR(uint8, AUTOMATIC) Index;
+
+	for (TaskID = 0; TaskID < TASK_COUNT; TaskID++)
+	{
+		Stats = &Os_SimTaskStats[TaskID];
+
+		/* New activations, time stamped with the current virtual time */
+		while (Stats->Pending < Tasks[TaskID].TaskDynamics->PendingActivationRequests)
+		{
+			if (Stats->Pending < OS_POSIX_SIM_MAX_ACTIVATIONS)
+			{
+				Stats->ActivationTime[Stats->Pending] = Os_SimNow;
+			}
+			Stats->Pending++;
+			Stats->Activations++;
+		}
+
+		/* Completed jobs, the oldest activation terminates first */
+		while (Stats->Pending > Tasks[TaskID].TaskDynamics->PendingActivationRequests)
+		{
+			Response = Os_SimNow - Stats->ActivationTime[0];
+
+			if ((0U == Stats->Completions) || (Response < Stats->BestResponse))
+			{
+				Stats->BestResponse = Response;
+			}
+			if (Response > Stats->WorstResponse)
+			{
+				Stats->WorstResponse = Response;
+			}
+			Stats->TotalResponse += Response;
+			Stats->Completions++;
+
+			for (Index = 1; (Index < Stats->Pending) && (Index < OS_POSIX_SIM_MAX_ACTIVATIONS); Index++)
+			{
+				Stats->ActivationTime[Index - 1U] = Stats->ActivationTime[Index];
+			}
+			Stats->Pending--;
+		}
+	}
+}
+
+void OS_SimDispatch(void)
+{
+	OS_SimTrace();
+
+	if ((Os_SimLastDispatched != Kernel.TaskRunning) || (TRUE == Os_SimIdleWaiting))
+	{
+#if (OS_POSIX_SIM_TRACE == STD_ON)
+		(void)printf("%10llu us: dispatch task %u\n", (unsigned long long)Os_SimNow, (unsigned)Kernel.TaskRunning->TaskID);
+#endif /* #if (OS_POSIX_SIM_TRACE == STD_ON) */
+
+		Os_SimTaskStats[Kernel.TaskRunning->TaskID].Dispatches++;
+		Os_SimLastDispatched = Kernel.TaskRunning;
+		Os_SimIdleWaiting    = FALSE;
+	}
+}
+
+Os_SimTimeType OS_SimDelayTick(uint32 Ticks)
+{
+	/* Os_SimNextTick is one period after the previous tick */
+	Os_SimNextTick += ((Os_SimTimeType)Ticks - 1U) * OS_POSIX_TICK_PERIOD_US;
+
+	return Os_SimNextTick;
+}
+
+void OS_SimSetCompare(Os_SimTimeType Time)
+{
+	Os_SimNextTick = (Time < OS_SIM_END_TIME) ? Time : OS_SIM_END_TIME;
+}
+
+void OS_SimTimerStart(const Os_CounterDriver *Driver)
+{
+	uint8 Channel = Driver->OsCounterDriverChannel;
+
+	if (Channel < OS_POSIX_TIMER_COUNT)
+	{
+		Os_SimTimers[Channel]    = Driver;
+		Os_SimTimerNext[Channel] = Os_SimNow + Driver->OsCounterDriverPeriod;
+	}
+}
+
+void OS_SimReport(void)
+{
+	VAR(uint8, AUTOMATIC) Channel;
+	VAR(TaskType, AUTOMATIC) TaskID;
+	P2VAR(Os_SimTaskStatsType, AUTOMATIC, OS_VAR) Stats;
+	VAR(Os_SimTimeType, AUTOMATIC) Busy = Os_SimNow - Os_SimTaskStats[IdleTaskId].ExecutionTime;
+
+	(void)printf("Virtual time: %llu us, %u ticks of %u us\n",
+			(unsigned long long)Os_SimNow, (unsigned)(Os_SimNow / OS_POSIX_TICK_PERIOD_US), (unsigned)OS_POSIX_TICK_PERIOD_US);
+	(void)printf("CPU load: %llu.%02llu %%\n",
+			(unsigned long long)((Busy * 100U) / Os_SimNow), (unsigned long long)(((Busy * 10000U) / Os_SimNow) % 100U));
+	(void)printf("Tick interrupts: %u, %llu.%02llu per second\n", (unsigned)Os_SimTickInterrupts,
+			(unsigned long long)(((uint64)Os_SimTickInterrupts * 1000000U) / Os_SimNow),
+			(unsigned long long)((((uint64)Os_SimTickInterrupts * 100000000U) / Os_SimNow) % 100U));
+#if (OS_TICK_DEFERRED == STD_ON)
+	(void)printf("Deferred expiry interrupts: %u\n", (unsigned)Os_SimDeferredInterrupts);
+#endif /* #if (OS_TICK_DEFERRED == STD_ON) */
+	for (Channel = 0U; Channel < OS_POSIX_TIMER_COUNT; Channel++)
+	{
+		if (NULL_PTR != Os_SimTimers[Channel])
+		{
+			(void)printf("Timer %u interrupts: %u, %llu.%02llu per second\n", (unsigned)Channel, (unsigned)Os_SimTimerInterrupts[Channel],
+					(unsigned long long)(((uint64)Os_SimTimerInterrupts[Channel] * 1000000U) / Os_SimNow),
+					(unsigned long long)((((uint64)Os_SimTimerInterrupts[Channel] * 100000000U) / Os_SimNow) % 100U));
+		}
+	}
+	(void)printf("%-6s %10s %10s %10s %12s %10s %10s %10s\n",
+			"Task", "Activated", "Completed", "Dispatched", "Exec[us]", "BCRT[us]", "WCRT[us]", "ACRT[us]");
+
+	for (TaskID = 0; TaskID <= IdleTaskId; TaskID++)
+	{
+		Stats = &Os_SimTaskStats[TaskID];
+
+		if (IdleTaskId == TaskID)
+		{
+			(void)printf("%-6s %10s %10s %10u %12llu\n", "Idle", "-", "-",
+					(unsigned)Stats->Dispatches, (unsigned long long)Stats->ExecutionTime);
+		}
+		else
+		{
+			(void)printf("%-6u %10u %10u %10u %12llu %10llu %10llu %10llu\n", (unsigned)TaskID,
+					(unsigned)Stats->Activations, (unsigned)Stats->Completions, (unsigned)Stats->Dispatches,
+					(unsigned long long)Stats->ExecutionTime, (unsigned long long)Stats->BestResponse,
+					(unsigned long long)Stats->WorstResponse,
+					(unsigned long long)((0U == Stats->Completions) ? 0U : (Stats->TotalResponse / Stats->Completions)));
+		}
+	}
+}
+
+#else /* #if (OS_POSIX_VIRTUAL_TIME == STD_ON) */
+
+void OS_SimExecute(uint32 Cost)
+{
+	struct timespec Start;
+	struct timespec Now;
+	uint64 Elapsed;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &Start);
+
+	/* Wall clock busy-wait, includes the time the task is preempted */
+	do
+	{
+		(void)clock_gettime(CLOCK_MONOTONIC, &Now);
+		Elapsed = ((uint64)(Now.tv_sec - Start.tv_sec) * 1000000U) + (uint64)((Now.tv_nsec - Start.tv_nsec) / 1000);
+	} while (Elapsed < Cost);
+}
+
+Os_SimTimeType OS_SimGetTime(void)
+{
+	return 0U;
+}
+
+void OS_SimReport(void)
+{
+	(void)printf("Schedule statistics need OS_POSIX_VIRTUAL_TIME == STD_ON\n");
+}
+
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_ON) */
+
+
+/***********************************************************************************/
+/*				    	 Internal Functions Definition		      				   */
+/***********************************************************************************/
+
+#if (OS_POSIX_VIRTUAL_TIME == STD_ON)
+
+/**
+ * @brief Advances the virtual clock by <Duration> on behalf of the running task.
+ *
+ * The remaining duration lives on the stack of the running task, a preemption by a
+ * tick suspends the loop until the task is dispatched again.
+ */
+static void Os_SimAdvance(Os_SimTimeType Duration)
+{
+	VAR(Os_SimTimeType, AUTOMATIC) Remaining = Duration;
+	VAR(Os_SimTimeType, AUTOMATIC) Step;
+
+	while (Remaining > 0U)
+	{
+		Step = Os_SimNextEvent() - Os_SimNow;
+		if (Step > Remaining)
+		{
+			Step = Remaining;
+		}
+
+		Os_SimNow += Step;
+		Remaining -= Step;
+		Os_SimTaskStats[(NULL_PTR == Kernel.TaskRunning) ? IdleTaskId : Kernel.TaskRunning->TaskID].ExecutionTime += Step;
+
+		if (Os_SimNow == Os_SimNextEvent())
+		{
+			Os_SimInterrupt();
+		}
+	}
+}
+
+/**
+ * @brief Virtual time of the next tick or interrupt of a simulated timer.
+ */
+static Os_SimTimeType Os_SimNextEvent(void)
+{
+	VAR(Os_SimTimeType, AUTOMATIC) Next = Os_SimNextTick;
+	VAR(uint8, AUTOMATIC) Channel;
+
+	for (Channel = 0U; Channel < OS_POSIX_TIMER_COUNT; Channel++)
+	{
+		if ((NULL_PTR != Os_SimTimers[Channel]) && (Os_SimTimerNext[Channel] < Next))
+		{
+			Next = Os_SimTimerNext[Channel];
+		}
+	}
+
+	return Next;
+}
+
+/**
+ * @brief Raises the interrupts due at the current virtual time, ends the simulation when
+ * OS_POSIX_SIM_TICKS tick periods have elapsed.
+ *
+ * Interrupts due together are raised as nested ISRs: like the interrupts tail-chained on
+ * the target, the rescheduling is done once after the last one.
+ */
+static void Os_SimInterrupt(void)
+{
+	VAR(uint8, AUTOMATIC) Channel;
+	VAR(boolean, AUTOMATIC) TimerDue = FALSE;
+
+	if (Os_SimNow >= OS_SIM_END_TIME)
+	{
+		OS_SimReport();
+		(void)fflush(stdout);
+		exit(EXIT_SUCCESS);
+	}
+
+	/* The interrupts are handled with the kernel locked */
+	OS_EnterKernel();
+
+	for (Channel = 0U; Channel < OS_POSIX_TIMER_COUNT; Channel++)
+	{
+		if ((NULL_PTR != Os_SimTimers[Channel]) && (Os_SimTimerNext[Channel] == Os_SimNow))
+		{
+			if (FALSE == TimerDue)
+			{
+				TimerDue = TRUE;
+				OS_IsrEnter();
+			}
+
+			Os_SimTimerNext[Channel] += Os_SimTimers[Channel]->OsCounterDriverPeriod;
+			Os_SimTimerInterrupts[Channel]++;
+			Os_SimTimers[Channel]->OsCounterDriverIsr();
+		}
+	}
+
+	if (Os_SimNow == Os_SimNextTick)
+	{
+		Os_SimTick();
+	}
+
+	if (TRUE == TimerDue)
+	{
+		OS_IsrExit();
+	}
+
+	OS_SimTrace();
+	OS_LeaveKernel();
+}
+
+/**
+ * @brief Raises the SysTick at the current virtual time, called by Os_SimInterrupt.
+ */
+static void Os_SimTick(void)
+{
+	Os_SimTickInterrupts++;
+
+#if (OS_COUNTER_COMPARE_TIMER == STD_ON)
+	/* One-shot compare, programmed again by the handler */
+	Os_SimNextTick = OS_SIM_END_TIME;
+	CounterTimer_Handler();
+#elif (OS_TICK_DEFERRED == STD_ON)
+	Os_SimNextTick += OS_POSIX_TICK_PERIOD_US;
+	SysTick_Handler();
+	if (TRUE == OS_PosixDeferredTake())
+	{
+		/* Counted first, the handler may switch to a task */
+		Os_SimDeferredInterrupts++;
+		CounterTimer_Handler();
+	}
+#else
+	Os_SimNextTick += OS_POSIX_TICK_PERIOD_US;
+	SysTick_Handler();
+#endif /* #if (OS_COUNTER_COMPARE_TIMER == STD_ON) */
+}
+
+#endif /* #if (OS_POSIX_VIRTUAL_TIME == STD_ON) */
+
+/***********************************************************************************/
+/*				    			 End Of File			         				   */
+/***********************************************************************************/
@@ -0,0 +1,286 @@
+/**
+ * @file            Os_syscalls_posix.c
+ * @author          Mahmoud Ismail
+ * @version         1.0.0
+ * @date            19-10-2026
+ * @platform        x86-64 Linux (host simulation)
+ * @variant
+ * @vendor          CryptOS
+ * @specification   OSEK/VDX
+ * @brief SVC entry wrappers of the POSIX host port.
+ *
+ * The arguments are handed to the emulated SVC in the same order as R0-R2 on the target.
+ */
+
+
+/*------------------------- MISRA-C vailoations in c files -----------------------*/
+
+/**********************************************************************************/
+/**				    			Include Headers			         				 **/
+/**********************************************************************************/
+#include <Os_kernel.h>
+#include <Os_syscalls.h>
+
+
+
+/***********************************************************************************/
+/*  			    			    Macros				         				   */
+/***********************************************************************************/
+
+/* Issues the emulated SVC <Service> with up to three arguments */
+#define OS_POSIX_SVC(Service, Arg0, Arg1, Arg2)	\
+	((StatusType)OS_PosixSystemCall((uint8)(Service), (unsigned long)(Arg0), (unsigned long)(Arg1), (unsigned long)(Arg2)))
+
+
+/***********************************************************************************/
+/*				    	 External Functions Definition		      				   */
+/***********************************************************************************/
+
+
+FUNC(void, OS_CODE) SVC_StartOS
+(
+    CONST(AppModeType, AUTOMATIC) Mode
+)
+{
+		/* Start SysTick, the first dispatch does not return to the caller */
+		OS_PosixStartTick();
+
+		(void)OS_POSIX_SVC(OS_SC_StartOs, Mode, 0, 0);
+}
+
+
+FUNC(StatusType, OS_CODE) SVC_ShutdownOS
+(
+    CONST(StatusType, AUTOMATIC) Error
+)
+{
+		return OS_POSIX_SVC(OS_SC_ShutdownOs, Error, 0, 0);
+}
+
+FUNC(StatusType, OS_CODE) SVC_RestartOS
+(
+    CONST(AppModeType, AUTOMATIC) Mode
+)
+{
+		return OS_POSIX_SVC(OS_SC_RestartOs, Mode, 0, 0);
+}
+
+
+FUNC(StatusType, OS_CODE) SVC_ActivateTask
+(
+    CONST(TaskType, AUTOMATIC) TaskID
+)
+{
+		return OS_POSIX_SVC(OS_SC_ActivateTask, TaskID, 0, 0);
+}
+
+FUNC(StatusType, OS_CODE) SVC_TerminateTask
+(
+    void
+)
+{
+		return OS_POSIX_SVC(OS_SC_TerminateTask, 0, 0, 0);
+}
+
+FUNC(StatusType, OS_CODE) SVC_ChainTask
+(
+    CONST(TaskType, AUTOMATIC) TaskID
+)
+{
+		return OS_POSIX_SVC(OS_SC_ChainTask, TaskID, 0, 0);
+}
+
+FUNC(StatusType, OS_CODE) SVC_Schedule
+(
+    void
+)
+{
+		return OS_POSIX_SVC(OS_SC_Schedule, 0, 0, 0);
+}
+
+FUNC(StatusType, OS_CODE) SVC_GetTaskID
+(
+    CONST(TaskRefType, AUTOMATIC) TaskID
+)
+{
+		return OS_POSIX_SVC(OS_SC_GetTaskID, TaskID, 0, 0);
+}
+
+FUNC(StatusType, OS_CODE) SVC_GetTaskState
+(
+    CONST(TaskType, AUTOMATIC) TaskID,
+    CONST(TaskStateRefType, AUTOMATIC) State
+)
+{
+		return OS_POSIX_SVC(OS_SC_GetTaskState, TaskID, State, 0);
+}
+
+FUNC(StatusType,OS_CODE) SVC_GetResource
+(
+	CONST(ResourceType,AUTOMATIC)	ResID
+)
+{
+		return OS_POSIX_SVC(OS_SC_GetResource, ResID, 0, 0);
+}
+
+FUNC(StatusType,OS_CODE) SVC_ReleaseResource
+(
+	CONST(ResourceType,AUTOMATIC)	ResID
+)
+{
+		return OS_POSIX_SVC(OS_SC_ReleaseResource, ResID, 0, 0);
+}
+
+FUNC(StatusType, OS_CODE) SVC_SetEvent
+(
+    CONST(TaskType, AUTOMATIC) TaskID,
+    CONST(EventMaskType, AUTOMATIC) Mask
+)
+{
+		return OS_POSIX_SVC(OS_SC_SetEvent, TaskID, Mask, 0);
+}
+
+FUNC(StatusType,OS_CODE) SVC_WaitEvent
+(
+    CONST(EventMaskType, AUTOMATIC) Mask
+)
+{
+		return OS_POSIX_SVC(OS_SC_WaitEvent, Mask, 0, 0);
+}
+
+FUNC(StatusType, OS_CODE) SVC_GetEvent
+(
+	        CONST(TaskType, AUTOMATIC) TaskID,
+          EventMaskRefType Event
+)
+{
+		return OS_POSIX_SVC(OS_SC_GetEvent, TaskID, Event, 0);
+}
+
+FUNC(StatusType,OS_CODE) SVC_ClearEvent
+(
+    CONST(EventMaskType, AUTOMATIC) Mask
+)
+{
+		return OS_POSIX_SVC(OS_SC_ClearEvent, Mask, 0, 0);
+}
+
+FUNC(StatusType,OS_CODE) SVC_GetAlarmBase
+(
+    CONST(AlarmType, AUTOMATIC) AlarmID,
+    P2VAR(AlarmBaseType, AUTOMATIC, OS_APPL_DATA) Info
+)
+{
+		return OS_POSIX_SVC(OS_SC_GetAlarmBase, AlarmID, Info, 0);
+}
+
+FUNC(StatusType,OS_CODE) SVC_GetAlarm
+(
+    CONST(AlarmType, AUTOMATIC) AlarmID,
+    P2VAR(TickType, AUTOMATIC, OS_APPL_DATA) Tick
+)
+{
+		return OS_POSIX_SVC(OS_SC_GetAlarm, AlarmID, Tick, 0);
+}
+
+FUNC(StatusType,OS_CODE) SVC_SetRelAlarm
+(
+    CONST(AlarmType, AUTOMATIC) AlarmID,
+    CONST(TickType, AUTOMATIC) increment,
+    CONST(TickType, AUTOMATIC) cycle
+)
+{
+		return OS_POSIX_SVC(OS_SC_SetRelAlarm, AlarmID, increment, cycle);
+}
+
+FUNC(StatusType,OS_CODE) SVC_SetAbsAlarm
+(
+    CONST(AlarmType, AUTOMATIC) AlarmID,
+    CONST(TickType, AUTOMATIC) start,
+    CONST(TickType, AUTOMATIC) cycle
+)
+{
+		return OS_POSIX_SVC(OS_SC_SetAbsAlarm, AlarmID, start, cycle);
+}
+
+FUNC(StatusType,OS_CODE) SVC_CancelAlarm
+(
+   CONST(AlarmType, AUTOMATIC) AlarmID
+)
+{
+		return OS_POSIX_SVC(OS_SC_CancelAlarm, AlarmID, 0, 0);
+}
+
+FUNC(StatusType,OS_CODE) SVC_StartScheduleTableRel
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID,
+    CONST(TickType, AUTOMATIC) Offset
+)
+{
+		return OS_POSIX_SVC(OS_SC_StartScheduleTableRel, ScheduleTableID, Offset, 0);
+}
+
+FUNC(StatusType,OS_CODE) SVC_StartScheduleTableAbs
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID,
+    CONST(TickType, AUTOMATIC) Start
+)
+{
+		return OS_POSIX_SVC(OS_SC_StartScheduleTableAbs, ScheduleTableID, Start, 0);
+}
+
+FUNC(StatusType,OS_CODE) SVC_StopScheduleTable
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID
+)
+{
+		return OS_POSIX_SVC(OS_SC_StopScheduleTable, ScheduleTableID, 0, 0);
+}
+
+FUNC(StatusType,OS_CODE) SVC_NextScheduleTable
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID_From,
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID_To
+)
+{
+		return OS_POSIX_SVC(OS_SC_NextScheduleTable, ScheduleTableID_From, ScheduleTableID_To, 0);
+}
+
+FUNC(StatusType,OS_CODE) SVC_GetScheduleTableStatus
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID,
+    ScheduleTableStatusRefType ScheduleStatus
+)
+{
+		return OS_POSIX_SVC(OS_SC_GetScheduleTableStatus, ScheduleTableID, ScheduleStatus, 0);
+}
+
+FUNC(StatusType,OS_CODE) SVC_StartScheduleTableSynchron
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID
+)
+{
+		return OS_POSIX_SVC(OS_SC_StartScheduleTableSynchron, ScheduleTableID, 0, 0);
+}
+
+FUNC(StatusType,OS_CODE) SVC_SyncScheduleTable
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID,
+    CONST(TickType, AUTOMATIC) Value
+)
+{
+		return OS_POSIX_SVC(OS_SC_SyncScheduleTable, ScheduleTableID, Value, 0);
+}
+
+FUNC(StatusType,OS_CODE) SVC_SetScheduleTableAsync
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID
+)
+{
+		return OS_POSIX_SVC(OS_SC_SetScheduleTableAsync, ScheduleTableID, 0, 0);
+}
+
+
+/***********************************************************************************/
+/*				    			 End Of File			         				   */
+/***********************************************************************************/
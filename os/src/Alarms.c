@@ -14,7 +14,7 @@
 /**********************************************************************************/
 /**				    			Include Headers			         				 **/
 /**********************************************************************************/
-#include <OS_kernel.h>
+#include <Os_kernel.h>
 
 /***********************************************************************************/
 /*  			    			    Macros				         				   */
@@ -46,6 +46,11 @@
 /*                              Internal Global Variables                          */
 /***********************************************************************************/
 
+#if (OS_ALARM_QUEUE != OS_ALARM_QUEUE_HEAP)
+/* Counter expiring its alarm list in OS_AlarmQueueTick, its alarms at the current value are due now */
+static P2CONST(Os_Counter, AUTOMATIC, OS_VAR) Os_AlarmTickingCounter = NULL_PTR;
+#endif /* #if (OS_ALARM_QUEUE != OS_ALARM_QUEUE_HEAP) */
+
 /***********************************************************************************/
 /*				    			Internal constants		         				   */
 /***********************************************************************************/
@@ -58,18 +63,38 @@
 /*				    	 Internal Functions Definition		      				   */
 /***********************************************************************************/
 
-/***********************************************************************************/
-/*                        External Function Definition                             */
-/***********************************************************************************/
-
-
+#if (OS_ALARM_QUEUE != OS_ALARM_QUEUE_HEAP)
 
+/**
+ * @brief Ticks from the current value of the counter of <Alarm> to its expiry. An expiry
+ * at the current value is a whole counter period away, except for the alarms being
+ * expired by OS_AlarmQueueTick.
+ */
+LOCAL_INLINE FUNC(TickType, OS_CODE)
+OS_AlarmTicksToExpiry(
+    P2CONST(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm)
+{
+    VAR(uint32, AUTOMATIC)
+    Modulo = (uint32)Alarm->OsAlarmCounterRef->OsCounterMaxAllowedValue + 1UL;
 
+    VAR(uint32, AUTOMATIC)
+    Ticks = ((uint32)Alarm->OsAlarmExpiryTime + Modulo - (uint32)Alarm->OsAlarmCounterRef->OsCounterCurrentTicks) % Modulo;
 
+    if ((0U == Ticks) && (Alarm->OsAlarmCounterRef != Os_AlarmTickingCounter))
+    {
+        Ticks = Modulo;
+    }
 
+    return (TickType)Ticks;
+}
 
+#endif /* #if (OS_ALARM_QUEUE != OS_ALARM_QUEUE_HEAP) */
 
+/***********************************************************************************/
+/*                        External Function Definition                             */
+/***********************************************************************************/
 
+#if (OS_ALARM_QUEUE != OS_ALARM_QUEUE_HEAP)
 
 /**
  * @brief Inserts a new alarm into the alarm list.
@@ -91,38 +116,28 @@ OS_AlarmInsert(
     CurrentAlarm = NULL_PTR;
 
     VAR(TickType, AUTOMATIC)
-    CurrentCounterTicks = NewAlarm->OsAlarmCounterRef->OsCounterCurrentTicks;
+    NewDelta = OS_AlarmTicksToExpiry(NewAlarm);
 
-    /* If List is empty */
-    if (NULL_PTR == *(Head))
-    {
-        *Head = NewAlarm;
-    }
-    /* If New alarm is smaller than Head and Head is smaller than CurrentCounterTicks */
-    else if (((*Head)->OsAlarmExpiryTime > NewAlarm->OsAlarmExpiryTime) && ((*Head)->OsAlarmExpiryTime < CurrentCounterTicks))
-    {
-        NewAlarm->OsAlarmNext = *Head;
-        NewAlarm->OsAlarmNext->OsAlarmPrevious = NewAlarm;
-        *Head = NewAlarm;
-    }
-    /* If New alarm is smaller than Head and New alarm is greater than CuurentCounterTcisk */
-    else if (((*Head)->OsAlarmExpiryTime > NewAlarm->OsAlarmExpiryTime) && (NewAlarm->OsAlarmExpiryTime > CurrentCounterTicks))
+    NewAlarm->OsAlarmPrevious = NULL_PTR;
+
+    /* If List is empty or the new alarm expires before the head */
+    if ((NULL_PTR == *(Head)) || (NewDelta < OS_AlarmTicksToExpiry(*Head)))
     {
         NewAlarm->OsAlarmNext = *Head;
-        NewAlarm->OsAlarmNext->OsAlarmPrevious = NewAlarm;
+        if (NULL_PTR != *Head)
+        {
+            (*Head)->OsAlarmPrevious = NewAlarm;
+        }
         *Head = NewAlarm;
     }
     else
     {
         CurrentAlarm = *Head;
 
-        /* Locate the node after which the new node is to be inserted */
-        /*while ((NULL_PTR != CurrentAlarm->OsAlarmNext) && (CurrentAlarm->OsAlarmNext->OsAlarmExpiryTime <= NewAlarm->OsAlarmExpiryTime))*/
+        /* Locate the node after which the new node is to be inserted, after the alarms
+           expiring at the same tick */
         while ((NULL_PTR != CurrentAlarm->OsAlarmNext) &&
-               ((CurrentAlarm->OsAlarmNext->OsAlarmExpiryTime <= NewAlarm->OsAlarmExpiryTime &&
-                 CurrentAlarm->OsAlarmNext->OsAlarmExpiryTime >= CurrentCounterTicks) ||
-                (CurrentAlarm->OsAlarmNext->OsAlarmExpiryTime >= NewAlarm->OsAlarmExpiryTime &&
-                 NewAlarm->OsAlarmExpiryTime <= CurrentCounterTicks)))
+               (OS_AlarmTicksToExpiry(CurrentAlarm->OsAlarmNext) <= NewDelta))
         {
             CurrentAlarm = CurrentAlarm->OsAlarmNext;
         }
@@ -225,6 +240,8 @@ OS_AlarmRemove(
     }
 }
 
+#endif /* #if (OS_ALARM_QUEUE != OS_ALARM_QUEUE_HEAP) */
+
 /**
  * @brief This function is responsible for executing the action associated with an alarm.
  *
@@ -253,11 +270,233 @@ OS_AlarmFireAction(
         /* Call the callback function */
         Alarm->OsAlarmAction.OsAlarmCallbackName();
         break;
+    case ALARM_INCREMENT_COUNTER:
+        /* The alarms of the counter expire nested in this one, the depth is bounded by
+           the generation (OS_COUNTER_CASCADE_DEPTH) */
+        OS_IncrementHardwreCounter(&Counters[Alarm->OsAlarmAction.OsAlarmIncrementCounter->OsAlarmIncrementCounterRef]);
+        break;
     default:
         break;
     }
 }
 
+FUNC(void, OS_CODE)
+OS_AlarmExpire(
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm)
+{
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA)
+    Counter = Alarm->OsAlarmCounterRef;
+
+    /* Queued again before the action: a callback may cancel or set the alarm */
+    if (Alarm->OsAlarmCycleTime != 0U)
+    {
+#if (OS_ALARM_SLACK == STD_ON)
+        /* From the expiry without slack, the delays do not add up over the cycles */
+        Alarm->OsAlarmExpiryTime = (Alarm->OsAlarmCycleTime + Alarm->OsAlarmNominalTime) % (Counter->OsCounterMaxAllowedValue + 1);
+#else
+        Alarm->OsAlarmExpiryTime = (Alarm->OsAlarmCycleTime + Alarm->OsAlarmExpiryTime) % (Counter->OsCounterMaxAllowedValue + 1);
+#endif /* #if (OS_ALARM_SLACK == STD_ON) */
+        OS_AlarmQueueInsert(Alarm);
+    }
+    else
+    {
+        Alarm->OsAlarmState = ALARM_SLEEP;
+    }
+
+    /* Fire the alarm action */
+    OS_AlarmFireAction(Alarm);
+}
+
+#if (OS_ALARM_SLACK == STD_ON)
+
+FUNC(void, OS_CODE)
+OS_AlarmCoalesce(
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm)
+{
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA)
+    Counter = Alarm->OsAlarmCounterRef;
+
+    VAR(uint32, AUTOMATIC)
+    Modulo = (uint32)Counter->OsCounterMaxAllowedValue + 1UL;
+
+    /* Ticks to the expiry, a whole period if it is the current value */
+    VAR(uint32, AUTOMATIC)
+    Ticks = ((uint32)Alarm->OsAlarmExpiryTime + Modulo - (uint32)Counter->OsCounterCurrentTicks) % Modulo;
+
+    VAR(uint32, AUTOMATIC)
+    Latest;
+
+    VAR(TickType, AUTOMATIC)
+    Shared;
+
+    Alarm->OsAlarmNominalTime = Alarm->OsAlarmExpiryTime;
+
+    if ((0U != Alarm->OsAlarmSlack) && (0U != Ticks))
+    {
+        /* Never delayed past a whole counter period */
+        Latest = Ticks + (uint32)Alarm->OsAlarmSlack;
+        if (Latest >= Modulo)
+        {
+            Latest = Modulo - 1UL;
+        }
+
+        Shared = OS_AlarmQueueFindExpiry(Counter, (TickType)Ticks, (TickType)Latest);
+
+        if (0U != Shared)
+        {
+            Alarm->OsAlarmExpiryTime = (TickType)(((uint32)Counter->OsCounterCurrentTicks + (uint32)Shared) % Modulo);
+        }
+    }
+}
+
+#endif /* #if (OS_ALARM_SLACK == STD_ON) */
+
+#if ((OS_ALARM_SLACK == STD_ON) && ((OS_ALARM_QUEUE == OS_ALARM_QUEUE_LIST) || (OS_ALARM_QUEUE == OS_ALARM_QUEUE_DELTA)))
+
+/* The list and the delta list are both ActiveAlarmsHead[OsCounterAlarmsHeadIndex] in expiry
+   order, the alarms due now first */
+FUNC(TickType, OS_CODE)
+OS_AlarmQueueFindExpiry(
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter,
+    CONST(TickType, AUTOMATIC) From,
+    CONST(TickType, AUTOMATIC) To)
+{
+    P2CONST(Os_Alarm, AUTOMATIC, OS_APPL_DATA)
+    Alarm = ActiveAlarmsHead[Counter->OsCounterAlarmsHeadIndex];
+
+    VAR(uint32, AUTOMATIC)
+    Modulo = (uint32)Counter->OsCounterMaxAllowedValue + 1UL;
+
+    VAR(uint32, AUTOMATIC)
+    Ticks;
+
+    VAR(TickType, AUTOMATIC)
+    Found = 0U;
+
+    while ((NULL_PTR != Alarm) && (0U == Found))
+    {
+        Ticks = ((uint32)Alarm->OsAlarmExpiryTime + Modulo - (uint32)Counter->OsCounterCurrentTicks) % Modulo;
+
+        if ((0U != Ticks) && (Ticks > (uint32)To))
+        {
+            /* The rest of the list expires later */
+            Alarm = NULL_PTR;
+        }
+        else
+        {
+            if (Ticks >= (uint32)From)
+            {
+                Found = (TickType)Ticks;
+            }
+
+            Alarm = Alarm->OsAlarmNext;
+        }
+    }
+
+    return Found;
+}
+
+#endif /* #if ((OS_ALARM_SLACK == STD_ON) && ((OS_ALARM_QUEUE == OS_ALARM_QUEUE_LIST) || (OS_ALARM_QUEUE == OS_ALARM_QUEUE_DELTA))) */
+
+#if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_LIST)
+
+/* Alarm queue of a counter: ActiveAlarmsHead[OsCounterAlarmsHeadIndex] sorted by expiry */
+
+FUNC(void, OS_CODE)
+OS_AlarmQueueInit(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter)
+{
+    ActiveAlarmsHead[Counter->OsCounterAlarmsHeadIndex] = NULL_PTR;
+}
+
+FUNC(void, OS_CODE)
+OS_AlarmQueueInsert(
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm)
+{
+#if (OS_ALARM_SLACK == STD_ON)
+    OS_AlarmCoalesce(Alarm);
+#endif /* #if (OS_ALARM_SLACK == STD_ON) */
+
+    OS_AlarmInsert(&ActiveAlarmsHead[Alarm->OsAlarmCounterRef->OsCounterAlarmsHeadIndex], Alarm);
+}
+
+FUNC(void, OS_CODE)
+OS_AlarmQueueRemove(
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm)
+{
+    OS_AlarmRemove(&ActiveAlarmsHead[Alarm->OsAlarmCounterRef->OsCounterAlarmsHeadIndex], Alarm);
+}
+
+FUNC(void, OS_CODE)
+OS_AlarmQueueTick(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter)
+{
+    P2VAR(Os_Alarm *, AUTOMATIC, OS_APPL_DATA)
+    Head = &ActiveAlarmsHead[Counter->OsCounterAlarmsHeadIndex];
+
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA)
+    Alarm = *Head;
+
+    /* Counter ticking around this one: an ALARM_INCREMENT_COUNTER alarm ticks its
+       counter nested in the expiry loop of another */
+    P2CONST(Os_Counter, AUTOMATIC, OS_VAR)
+    Outer = Os_AlarmTickingCounter;
+
+    /* The alarms due now are at the head of the list, the cyclic ones are queued
+       again behind them */
+    Os_AlarmTickingCounter = Counter;
+
+    while ((NULL_PTR != Alarm) && (Counter->OsCounterCurrentTicks == Alarm->OsAlarmExpiryTime))
+    {
+        /* Remove the alarm from the list */
+        OS_AlarmRemoveHead(Head);
+
+        OS_AlarmExpire(Alarm);
+
+        /* Get the new head of the counter */
+        Alarm = *Head;
+    }
+
+    Os_AlarmTickingCounter = Outer;
+}
+
+FUNC(TickType, OS_CODE)
+OS_AlarmQueueNextExpiry(
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter)
+{
+    VAR(TickType, AUTOMATIC)
+    Ticks = 0U;
+
+    P2CONST(Os_Alarm, AUTOMATIC, OS_APPL_DATA)
+    Head = ActiveAlarmsHead[Counter->OsCounterAlarmsHeadIndex];
+
+    if (NULL_PTR != Head)
+    {
+        Ticks = OS_AlarmTicksToExpiry(Head);
+    }
+
+    return Ticks;
+}
+
+FUNC(void, OS_CODE)
+OS_AlarmQueueSkip(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter,
+    CONST(TickType, AUTOMATIC) Ticks)
+{
+    /* The expiry times are counter values, nothing to follow */
+    (void)Counter;
+    (void)Ticks;
+}
+
+FUNC(TickType, OS_CODE)
+OS_AlarmQueueRemaining(
+    P2CONST(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm)
+{
+    return OS_AlarmTicksToExpiry(Alarm);
+}
+
+#endif /* #if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_LIST) */
+
 /***********************************************************************************/
 /*				    			 End Of File			         				   */
 /***********************************************************************************/
\ No newline at end of file
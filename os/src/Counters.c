@@ -15,7 +15,9 @@
 /**********************************************************************************/
 /**				    			Include Headers			         				 **/
 /**********************************************************************************/
-#include <OS_kernel.h>
+#include <Os_kernel.h>
+/* OS_GetCounterValue, OS_GetElapsedValue and OS_GetCounterValueExtended */
+#include <Os_Api.h>
 
 /***********************************************************************************/
 /*  			    			    Macros				         				   */
@@ -37,37 +39,72 @@
 /***************************************************************************************/
 /*                            External Global Variables                                */
 /***************************************************************************************/
-/* Extern Functions from Systemcall.asm */
+#if (OS_TICK_DEFERRED == STD_ON)
+/* Ticks counted by SysTick, the timer of the counter timer driver of Counters[0]. Read by
+   the tasks with the time snapshots, placed in their section. */
+static volatile VAR(uint32, OS_VAR) Os_TickCount OS_COUNTER_TIME_SECTION = 0U;
 
-extern void SaveAndSwitchContext(void);
-extern void NewTaskStackInit(int);
+/* Tick count at which the deferred expiry handler is pended */
+static volatile VAR(uint32, OS_VAR) Os_TickDue = 0U;
 
-/* Systick Handler */
+/* Systick Handler: counts the tick and pends the deferred expiry handler on the tick where
+   an alarm or an expiry point falls due. No kernel entry, the kernel data is not touched. */
+FUNC(void, OS_CODE) SysTick_Handler(void)
+{
+    VAR(uint32, AUTOMATIC) Count = Os_TickCount + 1U;
+
+    Os_TickCount = Count;
+
+    if (Count == Os_TickDue)
+    {
+        Os_TickDeferredPend();
+    }
+}
+#else
+/* Systick Handler, the rescheduling is done by the ISR exit */
 
-void SysTick_Handler(void)
+ISR(SysTick_Handler)
 {
 #if (COUNTER_COUNT > 0)
-    /* Increment the counter value */
-    OS_IncrementHardwreCounter(&Counters[0]);
+    OS_CounterDriverTick(&Counters[0]);
+#endif /* (COUNTER_COUNT > 0) */
+}
+#endif /* #if (OS_TICK_DEFERRED == STD_ON) */
 
-    /* Check if the scheduler is needed */
-    if (Kernel.SchedulerNeeded == TRUE)
-    {
-        /* Call the scheduler */
-        Kern_Schedule();
+#if (OS_COUNTER_TIMER_DRIVER == STD_ON)
+/* Compare interrupt of the timer of Counters[0], with OS_TICK_DEFERRED the deferred expiry
+   handler pended by SysTick: the due alarms expire and the compare is programmed for the
+   next expiry, the rescheduling is done by the ISR exit */
+ISR(CounterTimer_Handler)
+{
+#if (COUNTER_COUNT > 0)
+    OS_KERNEL_LOCK();
 
-        /* Check if the context is new */
-        if (Kernel.NewContext == TRUE)
-        {
-            NewTaskStackInit(NEW_TASK_STACK_FROM_ISR);
-        }
-        else
-        {
-            SaveAndSwitchContext();
-        }
-    }
+    OS_CounterTimerProgram(&Counters[0]);
+
+    OS_KERNEL_UNLOCK();
 #endif /* (COUNTER_COUNT > 0) */
 }
+#endif /* #if (OS_COUNTER_TIMER_DRIVER == STD_ON) */
+
+#if (OS_TICK_DEFERRED == STD_ON)
+/* Timer of the counter timer driver: the ticks counted by SysTick, the compare is the tick
+   count pending the deferred expiry handler. SysTick is started by the port. */
+FUNC(void, OS_CODE) Os_CounterTimerStart(void)
+{
+}
+
+FUNC(uint32, OS_CODE) Os_CounterTimerRead(void)
+{
+    return Os_TickCount;
+}
+
+FUNC(void, OS_CODE) Os_CounterTimerSetCompare(CONST(uint32, AUTOMATIC) Compare)
+{
+    /* A tick count already passed is caught up by OS_CounterTimerProgram */
+    Os_TickDue = Compare;
+}
+#endif /* #if (OS_TICK_DEFERRED == STD_ON) */
 
 /***********************************************************************************/
 /*				    			External constants		         				   */
@@ -89,11 +126,140 @@ void SysTick_Handler(void)
 /*				    	 Internal Functions Definition		      				   */
 /***********************************************************************************/
 
+#if (COUNTER_COUNT > 0)
+/**
+ * @brief Adds <Ticks> to the value of <Counter> and to its time snapshot.
+ *
+ * Below the wrap the snapshot only takes the new value. A wrap adds the laps passed to the
+ * epoch of the snapshot within an update of its generation.
+ *
+ * @param Counter Pointer to the counter.
+ * @param Ticks   Number of ticks.
+ */
+static FUNC(void, OS_CODE)
+Os_CounterAddTicks(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter,
+    CONST(uint32, AUTOMATIC) Ticks)
+{
+    P2VAR(Os_CounterTime, AUTOMATIC, OS_VAR)
+    Time = Counter->OsCounterTime;
+
+    VAR(uint32, AUTOMATIC)
+    Modulo = (uint32)Counter->OsCounterMaxAllowedValue + 1UL;
+
+    /* Ticks to the next tick 0 */
+    VAR(uint32, AUTOMATIC)
+    ToWrap = Modulo - (uint32)Counter->OsCounterCurrentTicks;
+
+    VAR(uint32, AUTOMATIC)
+    Rest;
+
+    VAR(boolean, AUTOMATIC)
+    Opened;
+
+    if (Ticks < ToWrap)
+    {
+        Counter->OsCounterCurrentTicks = (TickType)((uint32)Counter->OsCounterCurrentTicks + Ticks);
+        Time->OsCounterTimeTicks       = Counter->OsCounterCurrentTicks;
+    }
+    else
+    {
+        Rest   = Ticks - ToWrap;
+        Opened = OS_CounterTimeBegin(Counter);
+
+        Counter->OsCounterCurrentTicks = (TickType)(Rest % Modulo);
+        Time->OsCounterTimeTicks       = Counter->OsCounterCurrentTicks;
+        Time->OsCounterTimeEpoch      += (ExtendedTickType)Modulo + (ExtendedTickType)(Rest - (uint32)Counter->OsCounterCurrentTicks);
+
+        OS_CounterTimeEnd(Counter, Opened);
+    }
+}
+
+/**
+ * @brief Reads the time snapshot of the counter <CounterID>, called by the tasks.
+ *
+ * The generation is taken before and after the fields, the read is retried while the
+ * kernel updates the snapshot. With the counter timer driver the timer counts not yet
+ * added to Counters[0] are added.
+ *
+ * @param CounterID Valid counter.
+ * @param Ticks     Current value of the counter.
+ * @param Value     Extended value of the counter.
+ */
+static FUNC(void, OS_CODE)
+Os_CounterTimeRead(
+    CONST(CounterType, AUTOMATIC) CounterID,
+    P2VAR(TickType, AUTOMATIC, AUTOMATIC) Ticks,
+    P2VAR(ExtendedTickType, AUTOMATIC, AUTOMATIC) Value)
+{
+    P2CONST(Os_CounterTime, AUTOMATIC, OS_VAR)
+    Time = &CounterTimes[CounterID];
+
+    VAR(uint32, AUTOMATIC)
+    Generation;
+
+    VAR(TickType, AUTOMATIC)
+    Current;
+
+    VAR(ExtendedTickType, AUTOMATIC)
+    Epoch;
+
+#if (OS_COUNTER_TIMER_DRIVER == STD_ON)
+    VAR(uint32, AUTOMATIC)
+    Counts = 0U;
+
+    VAR(uint32, AUTOMATIC)
+    Modulo;
+#endif /* #if (OS_COUNTER_TIMER_DRIVER == STD_ON) */
+
+    do
+    {
+        /* An odd generation: wait for the end of the update */
+        do
+        {
+            Generation = Time->OsCounterTimeGeneration;
+        } while (0U != (Generation & 1U));
+
+        OS_MEMORY_BARRIER();
+
+        Current = Time->OsCounterTimeTicks;
+        Epoch   = Time->OsCounterTimeEpoch;
+
+#if (OS_COUNTER_TIMER_DRIVER == STD_ON)
+        if (0U == CounterID)
+        {
+            Counts = Os_CounterTimerRead() - Time->OsCounterTimeTimerLast;
+        }
+#endif /* #if (OS_COUNTER_TIMER_DRIVER == STD_ON) */
+
+        OS_MEMORY_BARRIER();
+    } while (Generation != Time->OsCounterTimeGeneration);
+
+#if (OS_COUNTER_TIMER_DRIVER == STD_ON)
+    /* At most one counter period: the compare is programmed at least once per period */
+    Modulo  = (uint32)Time->OsCounterTimeMaxAllowedValue + 1UL;
+    Counts += (uint32)Current;
+
+    if (Counts >= Modulo)
+    {
+        Counts -= Modulo;
+        Epoch  += (ExtendedTickType)Modulo;
+    }
+
+    Current = (TickType)Counts;
+#endif /* #if (OS_COUNTER_TIMER_DRIVER == STD_ON) */
+
+    *Ticks = Current;
+    *Value = Epoch + (ExtendedTickType)Current;
+}
+
+#endif /* (COUNTER_COUNT > 0) */
+
 /**
  * @brief Increments the hardware counter and handles alarm expiration.
  *
  * This function increments the given hardware counter by one and checks if any alarms associated with the counter have expired.
- * If an alarm has expired, it is removed from the list, its action is fired, and if it is cyclic, its expiry time is updated.
+ * If an alarm has expired, it is removed from the queue, its action is fired, and if it is cyclic, it is queued again.
  *
  * @param Counter Pointer to the hardware counter to be incremented.
  */
@@ -103,54 +269,228 @@ OS_IncrementHardwreCounter(
 {
 
 #if (COUNTER_COUNT > 0)
-    /* Get Counter Head Index */
-    VAR(uint8, AUTOMATIC)
-    ActiveAlarmsHeadIndex;
-
-    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA)
-    Alarm = NULL_PTR;
-
     if (NULL_PTR == Counter)
     {
         /* Do Nothing */
     }
     else
     {
-        /* Get the counter head index */
-        ActiveAlarmsHeadIndex = Counter->OsCounterAlarmsHeadIndex;
+        /* Increment the counter value, 0 after OsCounterMaxAllowedValue */
+        Os_CounterAddTicks(Counter, 1U);
+
+        /* Expire the alarms due at the new counter value */
+        OS_AlarmQueueTick(Counter);
 
-        /* Get the head of the counter */
-        Alarm = ActiveAlarmsHead[ActiveAlarmsHeadIndex];
+#if (SCHEDULE_TABLE_COUNT > 0)
+        /* Then the expiry points due at the same value */
+        OS_ScheduleTableTick(Counter);
+#endif /* #if (SCHEDULE_TABLE_COUNT > 0) */
+    }
+#endif /* (COUNTER_COUNT > 0) */
+}
+
+/**
+ * @brief Advances the counter by <Ticks> ticks at once.
+ *
+ * The ticks without expiry are added to the counter in one step, the alarm queue is only
+ * ticked on the ticks where an alarm may fall due. The alarms due in the interval expire in
+ * expiry order, a cyclic alarm is re-armed from its own expiry and expires again within
+ * the interval if its cycle allows. The alarm actions only request the rescheduling,
+ * it is decided once by the exit of the calling ISR or system call.
+ *
+ * @param Counter Pointer to the counter to be advanced.
+ * @param Ticks   Number of ticks, 0 does nothing.
+ */
+FUNC(void, OS_CODE)
+OS_AdvanceHardwareCounter(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter,
+    CONST(TickType, AUTOMATIC) Ticks)
+{
+#if (COUNTER_COUNT > 0)
+    VAR(uint32, AUTOMATIC)
+    Remaining = (uint32)Ticks;
+
+    VAR(uint32, AUTOMATIC)
+    Step;
 
-        /* Increment the counter value */
-        Counter->OsCounterCurrentTicks++;
+    while (Remaining > 0U)
+    {
+        /* Ticks to the next tick where an alarm or an expiry point may fall due */
+        Step = (uint32)OS_CounterNextExpiry(Counter);
 
-        if (Counter->OsCounterCurrentTicks > Counter->OsCounterMaxAllowedValue)
+        if ((0U == Step) || (Step > Remaining))
         {
-            Counter->OsCounterCurrentTicks = 0;
+            /* No expiry in the rest of the interval */
+            Os_CounterAddTicks(Counter, Remaining);
+            OS_AlarmQueueSkip(Counter, (TickType)Remaining);
+            Remaining = 0U;
         }
-
-        /* Check if the counter value is equal to the ticks per base */
-        while ((NULL_PTR != Alarm) && (Counter->OsCounterCurrentTicks == Alarm->OsAlarmExpiryTime))
+        else
         {
-            /* Remove the alarm from the list */
-            OS_AlarmRemoveHead(&ActiveAlarmsHead[ActiveAlarmsHeadIndex]);
+            /* Up to the tick before the expiry, the expiry tick is a normal increment */
+            Os_CounterAddTicks(Counter, Step - 1UL);
+            OS_AlarmQueueSkip(Counter, (TickType)(Step - 1UL));
+            OS_IncrementHardwreCounter(Counter);
+            Remaining -= Step;
+        }
+    }
+#else
+    (void)Counter;
+    (void)Ticks;
+#endif /* (COUNTER_COUNT > 0) */
+}
+
+/**
+ * @brief Starts the tick source of <Counter>.
+ *
+ * @param Counter Pointer to the counter, nothing is done without driver or start function.
+ */
+FUNC(void, OS_CODE)
+OS_CounterDriverStart(
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter)
+{
+    P2CONST(Os_CounterDriver, AUTOMATIC, OS_CONST)
+    Driver = Counter->OsCounterDriver;
 
-            /* Fire the alarm action */
-            OS_AlarmFireAction(Alarm);
+    if ((NULL_PTR != Driver) && (NULL_PTR != Driver->OsCounterDriverStart))
+    {
+        Driver->OsCounterDriverStart(Driver);
+    }
+}
 
-            /* If the alarm is cyclic, update its expiry time */
-            if (Alarm->OsAlarmCycleTime != 0U)
-            {
-                Alarm->OsAlarmExpiryTime = (Alarm->OsAlarmCycleTime + Alarm->OsAlarmExpiryTime) % (Counter->OsCounterMaxAllowedValue + 1);
-                OS_AlarmInsert(&ActiveAlarmsHead[ActiveAlarmsHeadIndex], Alarm);
-            }
+/**
+ * @brief Tick of a hardware counter, called by its tick ISR.
+ *
+ * The timer is acknowledged, then the counter is incremented with the other Category 2
+ * ISRs masked. The rescheduling is done by the ISR exit.
+ *
+ * @param Counter Pointer to the counter.
+ */
+FUNC(void, OS_CODE)
+OS_CounterDriverTick(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter)
+{
+    P2CONST(Os_CounterDriver, AUTOMATIC, OS_CONST)
+    Driver = Counter->OsCounterDriver;
 
-            /* Get the new head of the counter */
-            Alarm = ActiveAlarmsHead[ActiveAlarmsHeadIndex];
-        }
+    if ((NULL_PTR != Driver) && (NULL_PTR != Driver->OsCounterDriverAck))
+    {
+        Driver->OsCounterDriverAck(Driver);
+    }
+
+    /* Mask the other Category 2 ISRs while the alarms are processed */
+    OS_KERNEL_LOCK();
+
+    /* Increment the counter value */
+    OS_IncrementHardwreCounter(Counter);
+
+    OS_KERNEL_UNLOCK();
+}
+
+/**
+ * @brief Sets <Counter> and its time snapshot to 0.
+ *
+ * @param Counter Pointer to the counter.
+ */
+FUNC(void, OS_CODE)
+OS_CounterTimeInit(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter)
+{
+    P2VAR(Os_CounterTime, AUTOMATIC, OS_VAR)
+    Time = Counter->OsCounterTime;
+
+    VAR(boolean, AUTOMATIC)
+    Opened = OS_CounterTimeBegin(Counter);
+
+    Counter->OsCounterCurrentTicks     = 0U;
+    Time->OsCounterTimeMaxAllowedValue = Counter->OsCounterMaxAllowedValue;
+    Time->OsCounterTimeTicks           = 0U;
+    Time->OsCounterTimeTimerLast       = 0U;
+    Time->OsCounterTimeEpoch           = 0U;
+
+    OS_CounterTimeEnd(Counter, Opened);
+}
+
+/**
+ * @brief Opens an update of the time snapshot of <Counter>.
+ *
+ * The updates of a counter are made with the kernel locked, a nested update (the wrap of a
+ * counter brought up to its timer) is part of the open one.
+ *
+ * @param Counter Pointer to the counter.
+ * @return TRUE if the update was opened, FALSE if one was already open.
+ */
+FUNC(boolean, OS_CODE)
+OS_CounterTimeBegin(
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter)
+{
+    P2VAR(Os_CounterTime, AUTOMATIC, OS_VAR)
+    Time = Counter->OsCounterTime;
+
+    VAR(boolean, AUTOMATIC)
+    Opened = FALSE;
+
+    if (0U == (Time->OsCounterTimeGeneration & 1U))
+    {
+        Time->OsCounterTimeGeneration = Time->OsCounterTimeGeneration + 1U;
+
+        /* The generation is odd before the fields change */
+        OS_MEMORY_BARRIER();
+
+        Opened = TRUE;
+    }
+
+    return Opened;
+}
+
+/**
+ * @brief Closes the update of the time snapshot of <Counter>.
+ *
+ * @param Counter Pointer to the counter.
+ * @param Opened  Returned by OS_CounterTimeBegin, nothing is done if FALSE.
+ */
+FUNC(void, OS_CODE)
+OS_CounterTimeEnd(
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter,
+    CONST(boolean, AUTOMATIC) Opened)
+{
+    P2VAR(Os_CounterTime, AUTOMATIC, OS_VAR)
+    Time = Counter->OsCounterTime;
+
+    if (TRUE == Opened)
+    {
+        /* The fields are written before the generation is even again */
+        OS_MEMORY_BARRIER();
+
+        Time->OsCounterTimeGeneration = Time->OsCounterTimeGeneration + 1U;
     }
-#endif /* (COUNTER_COUNT > 0) */
+}
+
+/**
+ * @brief Ticks from the current value of <Counter> to the next tick where an alarm or an
+ * expiry point of a schedule table may fall due.
+ *
+ * @param Counter Pointer to the counter.
+ * @return 0 if no alarm and no schedule table is active on the counter.
+ */
+FUNC(TickType, OS_CODE)
+OS_CounterNextExpiry(
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter)
+{
+    VAR(TickType, AUTOMATIC)
+    Ticks = OS_AlarmQueueNextExpiry(Counter);
+
+#if (SCHEDULE_TABLE_COUNT > 0)
+    VAR(TickType, AUTOMATIC)
+    TableTicks = OS_ScheduleTableNextExpiry(Counter);
+
+    if ((0U != TableTicks) && ((0U == Ticks) || (TableTicks < Ticks)))
+    {
+        Ticks = TableTicks;
+    }
+#endif /* #if (SCHEDULE_TABLE_COUNT > 0) */
+
+    return Ticks;
 }
 
 /***********************************************************************************/
@@ -189,66 +529,272 @@ OS_IncrementCounter(
     ErrorState = E_OK;
 
 #if (COUNTER_COUNT > 0)
-    /* Create pointer to an instance of Os_Counter struct*/
-    P2VAR(Os_Counter, OS_CODE, AUTOMATIC)
-    Counter = NULL_PTR;
-
-    /* Get Counter Head Index */
-    VAR(uint8, AUTOMATIC)
-    ActiveAlarmsHeadIndex;
+#if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
 
-    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA)
-    Alarm = NULL_PTR;
+    if (CounterID >= COUNTER_COUNT)
+    {
+        /* [SWS_Os_00285] If the input parameter <CounterID> is not valid shall return E_OS_ID.*/
+        ErrorState = E_OS_ID;
+    }
+    else if (Counters[CounterID].OsCounterType == COUNTER_HARDWARE)
+    {
+        /* [SWS_Os_00285] counter is implemented in hardware and can not be incremented by software*/
+        ErrorState = E_OS_ID;
+    }
+    else
+#endif /*(ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)*/
+    {
+        /*[SWS_Os_00286] If any alarm connected to this counter expires, the given action is done*/
+        OS_IncrementHardwreCounter(&Counters[CounterID]);
+    }
+#endif   /* (COUNTER_COUNT > 0) */
+    /* Return Error State */
+    return ErrorState;
+}
 
-    /* Get the counter head index */
-    ActiveAlarmsHeadIndex = Counter->OsCounterAlarmsHeadIndex;
+/**
+ * @brief This service advances a software counter by several ticks at once.
+ *
+ * @service name    OS_AdvanceCounter
+ * @syntax          FUNC(StatusType, OS_CODE) OS_AdvanceCounter
+ *                  (
+ *                      CONST(CounterType, AUTOMATIC) CounterID,
+ *                      CONST(TickType, AUTOMATIC) Ticks
+ *                  );
+ * @service ID  -
+ * @sync/async  Synchronous
+ * @reentrancy  Reentrant
+ * @param[in]  CounterID      Reference to the Counter to be advanced.
+ * @param[in]  Ticks          Number of ticks, 0 does nothing.
+ * @param[out] -
+ * @return     StatusType     Indicates the error status
+ *             Standard:
+ *                  • E_OK      No error
+ *             Extended:
+ *                  • E_OS_ID   The CounterID was not valid or counter is implemented in hardware
+ * @see       OS_IncrementCounter
+ * @note      Same as <Ticks> calls of IncrementCounter, the alarms due in the interval
+ *            expire in expiry order and the rescheduling is decided once.
+ * @warning   -
+ */
+FUNC(StatusType, OS_CODE)
+OS_AdvanceCounter(
+    CONST(CounterType, AUTOMATIC) CounterID,
+    CONST(TickType, AUTOMATIC) Ticks)
+{
+    /* Init the error to no error */
+    VAR(StatusType, OS_CODE)
+    ErrorState = E_OK;
 
+#if (COUNTER_COUNT > 0)
 #if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
 
     if (CounterID >= COUNTER_COUNT)
     {
-        /* [SWS_Os_00285] If the input parameter <CounterID> is not valid shall return E_OS_ID.*/
         ErrorState = E_OS_ID;
     }
     else if (Counters[CounterID].OsCounterType == COUNTER_HARDWARE)
     {
-        /* [SWS_Os_00285] counter is implemented in hardware and can not be incremented by software*/
         ErrorState = E_OS_ID;
     }
     else
 #endif /*(ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)*/
     {
-        /* Access struct of <CounterID> */
-        Counter = &Counters[CounterID];
+        OS_AdvanceHardwareCounter(&Counters[CounterID], Ticks);
+    }
+#else
+    (void)CounterID;
+    (void)Ticks;
+#endif   /* (COUNTER_COUNT > 0) */
+    /* Return Error State */
+    return ErrorState;
+}
 
-        /* Increment the counter value */
-        (Counter->OsCounterCurrentTicks)++;
+/**
+ * @brief This service reads the current value of a counter.
+ *
+ * @service name    OS_GetCounterValue
+ * @syntax          FUNC(StatusType, OS_CODE) OS_GetCounterValue
+ *                  (
+ *                      CONST(CounterType, AUTOMATIC) CounterID,
+ *                      CONST(TickRefType, AUTOMATIC) Value
+ *                  );
+ * @service ID  -
+ * @sync/async  Synchronous
+ * @reentrancy  Reentrant
+ * @param[in]  CounterID      The Counter which tick value should be read.
+ * @param[out] Value          Contains the current tick value of the counter.
+ * @return     StatusType     Indicates the error status
+ *             Standard:
+ *                  • E_OK      No error
+ *             Extended:
+ *                  • E_OS_ID   The <CounterID> was not valid
+ * @see       OS_GetElapsedValue, OS_GetCounterValueExtended
+ * @note      Read from the time snapshot of the counter, without system call.
+ * @warning   Not callable from a Category 1 ISR or an alarm callback: the read waits for
+ *            the end of an update of the snapshot.
+ */
+FUNC(StatusType, OS_CODE)
+OS_GetCounterValue(
+    CONST(CounterType, AUTOMATIC) CounterID,
+    CONST(TickRefType, AUTOMATIC) Value)
+{
+    /* Init the error to no error */
+    VAR(StatusType, OS_CODE)
+    ErrorState = E_OK;
 
-        if (Counter->OsCounterCurrentTicks > Counter->OsCounterMaxAllowedValue)
-        {
-            Counter->OsCounterCurrentTicks = 0;
-        }
-        /*[SWS_Os_00286] If any alarm connected to this counter expires, the given action is done*/
-        /* Check if the counter value is equal to the ticks per base */
-        while ((NULL_PTR != Alarm) && (Counter->OsCounterCurrentTicks == Alarm->OsAlarmExpiryTime))
-        {
-            /* Remove the alarm from the list */
-            OS_AlarmRemoveHead(&ActiveAlarmsHead[ActiveAlarmsHeadIndex]);
+#if (COUNTER_COUNT > 0)
+    VAR(ExtendedTickType, AUTOMATIC)
+    Extended;
 
-            /* Fire the alarm action */
-            OS_AlarmFireAction(Alarm);
+#if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
 
-            /* If the alarm is cyclic, update its expiry time */
-            if (Alarm->OsAlarmCycleTime != 0U)
-            {
-                Alarm->OsAlarmExpiryTime += Alarm->OsAlarmCycleTime;
-                OS_AlarmInsert(&ActiveAlarmsHead[ActiveAlarmsHeadIndex], Alarm);
-            }
+    if (CounterID >= COUNTER_COUNT)
+    {
+        ErrorState = E_OS_ID;
+    }
+    else
+#endif /*(ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)*/
+    {
+        Os_CounterTimeRead(CounterID, Value, &Extended);
+    }
+#else
+    (void)CounterID;
+    (void)Value;
+#endif   /* (COUNTER_COUNT > 0) */
+    /* Return Error State */
+    return ErrorState;
+}
 
-            /* Get the new head of the counter */
-            Alarm = ActiveAlarmsHead[ActiveAlarmsHeadIndex];
-        }
+/**
+ * @brief This service reads the ticks elapsed on a counter since a previous value.
+ *
+ * @service name    OS_GetElapsedValue
+ * @syntax          FUNC(StatusType, OS_CODE) OS_GetElapsedValue
+ *                  (
+ *                      CONST(CounterType, AUTOMATIC) CounterID,
+ *                      CONST(TickRefType, AUTOMATIC) Value,
+ *                      CONST(TickRefType, AUTOMATIC) ElapsedValue
+ *                  );
+ * @service ID  -
+ * @sync/async  Synchronous
+ * @reentrancy  Reentrant
+ * @param[in]  CounterID      The Counter to be read.
+ * @param[in,out] Value       In: the previously read tick value of the counter.
+ *                            Out: the current tick value of the counter.
+ * @param[out] ElapsedValue   The difference to the previous read value.
+ * @return     StatusType     Indicates the error status
+ *             Standard:
+ *                  • E_OK      No error
+ *             Extended:
+ *                  • E_OS_ID   The <CounterID> was not valid
+ *                  • E_OS_VALUE The given <Value> was not valid
+ * @see       OS_GetCounterValue
+ * @note      The counter wraps at most once between the two values, longer intervals are
+ *            measured with GetCounterValueExtended.
+ * @warning   Not callable from a Category 1 ISR or an alarm callback.
+ */
+FUNC(StatusType, OS_CODE)
+OS_GetElapsedValue(
+    CONST(CounterType, AUTOMATIC) CounterID,
+    CONST(TickRefType, AUTOMATIC) Value,
+    CONST(TickRefType, AUTOMATIC) ElapsedValue)
+{
+    /* Init the error to no error */
+    VAR(StatusType, OS_CODE)
+    ErrorState = E_OK;
+
+#if (COUNTER_COUNT > 0)
+    VAR(ExtendedTickType, AUTOMATIC)
+    Extended;
+
+    VAR(TickType, AUTOMATIC)
+    Current;
+
+    VAR(uint32, AUTOMATIC)
+    Modulo;
+
+#if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
+
+    if (CounterID >= COUNTER_COUNT)
+    {
+        ErrorState = E_OS_ID;
+    }
+    else if (*Value > CounterTimes[CounterID].OsCounterTimeMaxAllowedValue)
+    {
+        /* The previous value is beyond the range of the counter */
+        ErrorState = E_OS_VALUE;
+    }
+    else
+#endif /*(ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)*/
+    {
+        Os_CounterTimeRead(CounterID, &Current, &Extended);
+
+        Modulo = (uint32)CounterTimes[CounterID].OsCounterTimeMaxAllowedValue + 1UL;
+
+        *ElapsedValue = (TickType)((((uint32)Current + Modulo) - (uint32)*Value) % Modulo);
+        *Value        = Current;
+    }
+#else
+    (void)CounterID;
+    (void)Value;
+    (void)ElapsedValue;
+#endif   /* (COUNTER_COUNT > 0) */
+    /* Return Error State */
+    return ErrorState;
+}
+
+/**
+ * @brief This service reads the extended value of a counter, its ticks since StartOS.
+ *
+ * @service name    OS_GetCounterValueExtended
+ * @syntax          FUNC(StatusType, OS_CODE) OS_GetCounterValueExtended
+ *                  (
+ *                      CONST(CounterType, AUTOMATIC) CounterID,
+ *                      CONST(ExtendedTickRefType, AUTOMATIC) Value
+ *                  );
+ * @service ID  -
+ * @sync/async  Synchronous
+ * @reentrancy  Reentrant
+ * @param[in]  CounterID      The Counter to be read.
+ * @param[out] Value          Ticks of the counter since StartOS, on 64 bits.
+ * @return     StatusType     Indicates the error status
+ *             Standard:
+ *                  • E_OK      No error
+ *             Extended:
+ *                  • E_OS_ID   The <CounterID> was not valid
+ * @see       OS_GetCounterValue
+ * @note      The extended value does not wrap, an interval is the difference of two
+ *            values. Read from the time snapshot of the counter, without system call.
+ * @warning   Not callable from a Category 1 ISR or an alarm callback.
+ */
+FUNC(StatusType, OS_CODE)
+OS_GetCounterValueExtended(
+    CONST(CounterType, AUTOMATIC) CounterID,
+    CONST(ExtendedTickRefType, AUTOMATIC) Value)
+{
+    /* Init the error to no error */
+    VAR(StatusType, OS_CODE)
+    ErrorState = E_OK;
+
+#if (COUNTER_COUNT > 0)
+    VAR(TickType, AUTOMATIC)
+    Current;
+
+#if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
+
+    if (CounterID >= COUNTER_COUNT)
+    {
+        ErrorState = E_OS_ID;
+    }
+    else
+#endif /*(ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)*/
+    {
+        Os_CounterTimeRead(CounterID, &Current, Value);
     }
+#else
+    (void)CounterID;
+    (void)Value;
 #endif   /* (COUNTER_COUNT > 0) */
     /* Return Error State */
     return ErrorState;
@@ -67,7 +67,7 @@
  * @warning         -
  */
 
-FUNC(StatusType, OS_CODE) Os_ActivateTask
+FUNC(StatusType, OS_CODE) OS_ActivateTask
 (
     CONST(TaskType, AUTOMATIC) TaskID
 )
@@ -0,0 +1,193 @@
+/**
+ * @file Os_AlarmDelta.c
+ * @author Mahmoud Ismail
+ * @version 1.0.0
+ * @date 19-10-2026
+ * @platform
+ * @variant
+ * @vendor CryptOS
+ * @specification OSEK/VDX
+ * @brief Delta list alarm queue (OS_ALARM_QUEUE_DELTA).
+ *
+ * The alarms of a counter are linked in ActiveAlarmsHead[] in expiry order, each one
+ * stores the ticks from the expiry of its predecessor (OsAlarmDelta), the head the
+ * ticks from the current counter value. A tick decrements the head only and expires the
+ * alarms reaching 0, no expiry time is compared and the counter wrap plays no part.
+ */
+
+/**********************************************************************************/
+/**				    			Include Headers			         				 **/
+/**********************************************************************************/
+#include <Os_kernel.h>
+
+#if ((OS_ALARM_QUEUE == OS_ALARM_QUEUE_DELTA) && (COUNTER_COUNT > 0))
+
+/***********************************************************************************/
+/*  			    			    Macros				         				   */
+/***********************************************************************************/
+
+/* Delta list of a counter */
+#define OS_DELTA_HEAD_OF(Counter)   (&ActiveAlarmsHead[(Counter)->OsCounterAlarmsHeadIndex])
+
+/***********************************************************************************/
+/*				    	 External Functions Definition		      				   */
+/***********************************************************************************/
+
+FUNC(void, OS_CODE)
+OS_AlarmQueueInit(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter)
+{
+    *OS_DELTA_HEAD_OF(Counter) = NULL_PTR;
+}
+
+FUNC(void, OS_CODE)
+OS_AlarmQueueInsert(
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm)
+{
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA)
+    Counter = Alarm->OsAlarmCounterRef;
+
+    P2VAR(Os_Alarm *, AUTOMATIC, OS_APPL_DATA)
+    Head = OS_DELTA_HEAD_OF(Counter);
+
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA)
+    Previous = NULL_PTR;
+
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA)
+    Next = *Head;
+
+    VAR(uint32, AUTOMATIC)
+    Modulo = (uint32)Counter->OsCounterMaxAllowedValue + 1UL;
+
+    VAR(uint32, AUTOMATIC)
+    Delta;
+
+#if (OS_ALARM_SLACK == STD_ON)
+    OS_AlarmCoalesce(Alarm);
+#endif /* #if (OS_ALARM_SLACK == STD_ON) */
+
+    /* Ticks to the expiry, a whole period if it is the current value */
+    Delta = ((uint32)Alarm->OsAlarmExpiryTime + Modulo - (uint32)Counter->OsCounterCurrentTicks) % Modulo;
+
+    if (0U == Delta)
+    {
+        Delta = Modulo;
+    }
+
+    /* Behind the alarms expiring earlier or at the same tick */
+    while ((NULL_PTR != Next) && (Next->OsAlarmDelta <= Delta))
+    {
+        Delta   -= Next->OsAlarmDelta;
+        Previous = Next;
+        Next     = Next->OsAlarmNext;
+    }
+
+    Alarm->OsAlarmDelta    = (TickType)Delta;
+    Alarm->OsAlarmPrevious = Previous;
+    Alarm->OsAlarmNext     = Next;
+
+    if (NULL_PTR != Next)
+    {
+        Next->OsAlarmDelta   -= (TickType)Delta;
+        Next->OsAlarmPrevious = Alarm;
+    }
+
+    if (NULL_PTR != Previous)
+    {
+        Previous->OsAlarmNext = Alarm;
+    }
+    else
+    {
+        *Head = Alarm;
+    }
+}
+
+FUNC(void, OS_CODE)
+OS_AlarmQueueRemove(
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm)
+{
+    /* The successor now counts from the predecessor of <Alarm> */
+    if (NULL_PTR != Alarm->OsAlarmNext)
+    {
+        Alarm->OsAlarmNext->OsAlarmDelta += Alarm->OsAlarmDelta;
+    }
+
+    OS_AlarmRemove(OS_DELTA_HEAD_OF(Alarm->OsAlarmCounterRef), Alarm);
+}
+
+FUNC(void, OS_CODE)
+OS_AlarmQueueTick(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter)
+{
+    P2VAR(Os_Alarm *, AUTOMATIC, OS_APPL_DATA)
+    Head = OS_DELTA_HEAD_OF(Counter);
+
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA)
+    Alarm = *Head;
+
+    if (NULL_PTR != Alarm)
+    {
+        Alarm->OsAlarmDelta--;
+
+        /* The due alarms are the head and its successors with a delta of 0 */
+        while ((NULL_PTR != Alarm) && (0U == Alarm->OsAlarmDelta))
+        {
+            OS_AlarmRemoveHead(Head);
+
+            OS_AlarmExpire(Alarm);
+
+            Alarm = *Head;
+        }
+    }
+}
+
+FUNC(TickType, OS_CODE)
+OS_AlarmQueueNextExpiry(
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter)
+{
+    P2CONST(Os_Alarm, AUTOMATIC, OS_APPL_DATA)
+    Head = *OS_DELTA_HEAD_OF(Counter);
+
+    return (NULL_PTR != Head) ? Head->OsAlarmDelta : 0U;
+}
+
+FUNC(void, OS_CODE)
+OS_AlarmQueueSkip(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter,
+    CONST(TickType, AUTOMATIC) Ticks)
+{
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA)
+    Head = *OS_DELTA_HEAD_OF(Counter);
+
+    /* Fewer ticks than the delta of the head */
+    if (NULL_PTR != Head)
+    {
+        Head->OsAlarmDelta -= Ticks;
+    }
+}
+
+FUNC(TickType, OS_CODE)
+OS_AlarmQueueRemaining(
+    P2CONST(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm)
+{
+    P2CONST(Os_Alarm, AUTOMATIC, OS_APPL_DATA)
+    Current = Alarm;
+
+    VAR(TickType, AUTOMATIC)
+    Ticks = 0U;
+
+    /* Sum of the deltas from the head up to <Alarm> */
+    while (NULL_PTR != Current)
+    {
+        Ticks  += Current->OsAlarmDelta;
+        Current = Current->OsAlarmPrevious;
+    }
+
+    return Ticks;
+}
+
+#endif /* #if ((OS_ALARM_QUEUE == OS_ALARM_QUEUE_DELTA) && (COUNTER_COUNT > 0)) */
+
+/***********************************************************************************/
+/*				    			 End Of File			         				   */
+/***********************************************************************************/
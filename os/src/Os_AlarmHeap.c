@@ -0,0 +1,336 @@
+/**
+ * @file Os_AlarmHeap.c
+ * @author Mahmoud Ismail
+ * @version 1.0.0
+ * @date 19-10-2026
+ * @platform
+ * @variant
+ * @vendor CryptOS
+ * @specification OSEK/VDX
+ * @brief Binary min-heap alarm queue (OS_ALARM_QUEUE_HEAP).
+ *
+ * The alarms of a counter are kept in the array of its Os_AlarmHeap, every alarm knows
+ * its position (OsAlarmHeapIndex): insert and remove are O(log n) without a search, the
+ * next expiry is Items[0]. The alarms carry no list links.
+ */
+
+/**********************************************************************************/
+/**				    			Include Headers			         				 **/
+/**********************************************************************************/
+#include <Os_kernel.h>
+
+#if ((OS_ALARM_QUEUE == OS_ALARM_QUEUE_HEAP) && (COUNTER_COUNT > 0))
+
+/***********************************************************************************/
+/*  			    			    Macros				         				   */
+/***********************************************************************************/
+
+#if (OS_ALARM_HEAP_SIZE >= OS_ALARM_HEAP_NONE)
+#error OS_ALARM_HEAP_SIZE does not fit the alarm heap positions!
+#endif /* #if (OS_ALARM_HEAP_SIZE >= OS_ALARM_HEAP_NONE) */
+
+/* Heap of a counter */
+#define OS_HEAP_OF(Counter)     (&AlarmHeaps[(Counter)->OsCounterAlarmsHeadIndex])
+
+/***********************************************************************************/
+/*                        Internal Function Declration                             */
+/***********************************************************************************/
+
+static FUNC(uint32, OS_CODE) Os_HeapKey
+(
+    P2CONST(Os_AlarmHeap, AUTOMATIC, OS_VAR) Heap,
+    P2CONST(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm
+);
+
+static FUNC(void, OS_CODE) Os_HeapSiftUp
+(
+    P2VAR(Os_AlarmHeap, AUTOMATIC, OS_VAR) Heap,
+    VAR(uint16, AUTOMATIC) Index,
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm
+);
+
+static FUNC(void, OS_CODE) Os_HeapSiftDown
+(
+    P2VAR(Os_AlarmHeap, AUTOMATIC, OS_VAR) Heap,
+    VAR(uint16, AUTOMATIC) Index,
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm
+);
+
+/***********************************************************************************/
+/*				    	 External Functions Definition		      				   */
+/***********************************************************************************/
+
+FUNC(void, OS_CODE)
+OS_AlarmQueueInit(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter)
+{
+    P2VAR(Os_AlarmHeap, AUTOMATIC, OS_VAR)
+    Heap = OS_HEAP_OF(Counter);
+
+    Heap->Last  = Counter->OsCounterCurrentTicks;
+    Heap->Count = 0U;
+}
+
+FUNC(void, OS_CODE)
+OS_AlarmQueueInsert(
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm)
+{
+    P2VAR(Os_AlarmHeap, AUTOMATIC, OS_VAR)
+    Heap = OS_HEAP_OF(Alarm->OsAlarmCounterRef);
+
+    if (Heap->Count < OS_ALARM_HEAP_SIZE)
+    {
+#if (OS_ALARM_SLACK == STD_ON)
+        OS_AlarmCoalesce(Alarm);
+#endif /* #if (OS_ALARM_SLACK == STD_ON) */
+
+        Heap->Count++;
+        Os_HeapSiftUp(Heap, (uint16)(Heap->Count - 1U), Alarm);
+    }
+    else
+    {
+        /* Heap full: the alarm is not queued, SetRelAlarm and SetAbsAlarm return E_OS_LIMIT */
+        Alarm->OsAlarmState = ALARM_SLEEP;
+    }
+}
+
+FUNC(void, OS_CODE)
+OS_AlarmQueueRemove(
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm)
+{
+    P2VAR(Os_AlarmHeap, AUTOMATIC, OS_VAR)
+    Heap = OS_HEAP_OF(Alarm->OsAlarmCounterRef);
+
+    VAR(uint16, AUTOMATIC)
+    Index = Alarm->OsAlarmHeapIndex;
+
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA)
+    LastAlarm;
+
+    if (OS_ALARM_HEAP_NONE != Index)
+    {
+        Alarm->OsAlarmHeapIndex = OS_ALARM_HEAP_NONE;
+
+        Heap->Count--;
+        LastAlarm = Heap->Items[Heap->Count];
+
+        /* The last alarm fills the hole, it may belong above or below it */
+        if (LastAlarm != Alarm)
+        {
+            if ((Index > 0U) && (Os_HeapKey(Heap, LastAlarm) < Os_HeapKey(Heap, Heap->Items[(Index - 1U) / 2U])))
+            {
+                Os_HeapSiftUp(Heap, Index, LastAlarm);
+            }
+            else
+            {
+                Os_HeapSiftDown(Heap, Index, LastAlarm);
+            }
+        }
+    }
+}
+
+FUNC(void, OS_CODE)
+OS_AlarmQueueTick(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter)
+{
+    P2VAR(Os_AlarmHeap, AUTOMATIC, OS_VAR)
+    Heap = OS_HEAP_OF(Counter);
+
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA)
+    Alarm;
+
+    /* The keys stay relative to the previous value until the due alarms are removed,
+       the due alarms have the key 0 */
+    while ((0U != Heap->Count) && (Counter->OsCounterCurrentTicks == Heap->Items[0]->OsAlarmExpiryTime))
+    {
+        Alarm = Heap->Items[0];
+
+        OS_AlarmQueueRemove(Alarm);
+
+        OS_AlarmExpire(Alarm);
+    }
+
+    Heap->Last = Counter->OsCounterCurrentTicks;
+}
+
+FUNC(TickType, OS_CODE)
+OS_AlarmQueueNextExpiry(
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter)
+{
+    P2CONST(Os_AlarmHeap, AUTOMATIC, OS_VAR)
+    Heap = OS_HEAP_OF(Counter);
+
+    VAR(TickType, AUTOMATIC)
+    Ticks = 0U;
+
+    if (0U != Heap->Count)
+    {
+        Ticks = (TickType)(Os_HeapKey(Heap, Heap->Items[0]) + 1UL);
+    }
+
+    return Ticks;
+}
+
+FUNC(void, OS_CODE)
+OS_AlarmQueueSkip(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter,
+    CONST(TickType, AUTOMATIC) Ticks)
+{
+    /* No alarm expired in the skipped ticks, the keys keep their order */
+    (void)Ticks;
+    OS_HEAP_OF(Counter)->Last = Counter->OsCounterCurrentTicks;
+}
+
+FUNC(TickType, OS_CODE)
+OS_AlarmQueueRemaining(
+    P2CONST(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm)
+{
+    return (TickType)(Os_HeapKey(OS_HEAP_OF(Alarm->OsAlarmCounterRef), Alarm) + 1UL);
+}
+
+#if (OS_ALARM_SLACK == STD_ON)
+FUNC(TickType, OS_CODE)
+OS_AlarmQueueFindExpiry(
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter,
+    CONST(TickType, AUTOMATIC) From,
+    CONST(TickType, AUTOMATIC) To)
+{
+    P2CONST(Os_AlarmHeap, AUTOMATIC, OS_VAR)
+    Heap = OS_HEAP_OF(Counter);
+
+    VAR(uint32, AUTOMATIC)
+    Modulo = (uint32)Counter->OsCounterMaxAllowedValue + 1UL;
+
+    VAR(uint32, AUTOMATIC)
+    Ticks;
+
+    VAR(uint16, AUTOMATIC)
+    Index;
+
+    VAR(TickType, AUTOMATIC)
+    Found = 0U;
+
+    /* The heap is only ordered along its paths: every alarm is looked at */
+    for (Index = 0U; Index < Heap->Count; Index++)
+    {
+        Ticks = ((uint32)Heap->Items[Index]->OsAlarmExpiryTime + Modulo - (uint32)Counter->OsCounterCurrentTicks) % Modulo;
+
+        if ((Ticks >= (uint32)From) && (Ticks <= (uint32)To) && ((0U == Found) || (Ticks < (uint32)Found)))
+        {
+            Found = (TickType)Ticks;
+        }
+    }
+
+    return Found;
+}
+#endif /* #if (OS_ALARM_SLACK == STD_ON) */
+
+/***********************************************************************************/
+/*				    	 Internal Functions Definition		      				   */
+/***********************************************************************************/
+
+/**
+ * @brief Ticks after the tick following Last at which <Alarm> expires: 0 for the next
+ * tick, OsCounterMaxAllowedValue for an expiry at Last (a whole counter period).
+ */
+static FUNC(uint32, OS_CODE) Os_HeapKey
+(
+    P2CONST(Os_AlarmHeap, AUTOMATIC, OS_VAR) Heap,
+    P2CONST(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm
+)
+{
+    VAR(uint32, AUTOMATIC)
+    Modulo = (uint32)Alarm->OsAlarmCounterRef->OsCounterMaxAllowedValue + 1UL;
+
+    return ((uint32)Alarm->OsAlarmExpiryTime + Modulo - (uint32)Heap->Last - 1UL) % Modulo;
+}
+
+/**
+ * @brief Places <Alarm> in the hole at <Index> or above it, moving the later parents down.
+ */
+static FUNC(void, OS_CODE) Os_HeapSiftUp
+(
+    P2VAR(Os_AlarmHeap, AUTOMATIC, OS_VAR) Heap,
+    VAR(uint16, AUTOMATIC) Index,
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm
+)
+{
+    VAR(uint32, AUTOMATIC)
+    Key = Os_HeapKey(Heap, Alarm);
+
+    VAR(uint16, AUTOMATIC)
+    Parent;
+
+    /* The sift stops at an equal key, the alarms of one tick expire in no defined order */
+    while (Index > 0U)
+    {
+        Parent = (uint16)((Index - 1U) / 2U);
+
+        if (Os_HeapKey(Heap, Heap->Items[Parent]) <= Key)
+        {
+            break;
+        }
+
+        Heap->Items[Index] = Heap->Items[Parent];
+        Heap->Items[Index]->OsAlarmHeapIndex = Index;
+        Index = Parent;
+    }
+
+    Heap->Items[Index] = Alarm;
+    Alarm->OsAlarmHeapIndex = Index;
+}
+
+/**
+ * @brief Places <Alarm> in the hole at <Index> or below it, moving the earlier children up.
+ */
+static FUNC(void, OS_CODE) Os_HeapSiftDown
+(
+    P2VAR(Os_AlarmHeap, AUTOMATIC, OS_VAR) Heap,
+    VAR(uint16, AUTOMATIC) Index,
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm
+)
+{
+    VAR(uint32, AUTOMATIC)
+    Key = Os_HeapKey(Heap, Alarm);
+
+    VAR(uint32, AUTOMATIC)
+    Child = (2UL * Index) + 1UL;
+
+    VAR(uint32, AUTOMATIC)
+    ChildKey;
+
+    /* Never above OS_ALARM_HEAP_SIZE, the insert checks it */
+    VAR(uint32, AUTOMATIC)
+    Count = (Heap->Count < OS_ALARM_HEAP_SIZE) ? Heap->Count : OS_ALARM_HEAP_SIZE;
+
+    while (Child < Count)
+    {
+        ChildKey = Os_HeapKey(Heap, Heap->Items[Child]);
+
+        /* The earlier of the two children */
+        if (((Child + 1UL) < Count) && (Os_HeapKey(Heap, Heap->Items[Child + 1UL]) < ChildKey))
+        {
+            Child++;
+            ChildKey = Os_HeapKey(Heap, Heap->Items[Child]);
+        }
+
+        if (Key <= ChildKey)
+        {
+            break;
+        }
+
+        Heap->Items[Index] = Heap->Items[Child];
+        Heap->Items[Index]->OsAlarmHeapIndex = Index;
+        Index = (uint16)Child;
+        Child = (2UL * Index) + 1UL;
+    }
+
+    Heap->Items[Index] = Alarm;
+    Alarm->OsAlarmHeapIndex = Index;
+}
+
+#endif /* #if ((OS_ALARM_QUEUE == OS_ALARM_QUEUE_HEAP) && (COUNTER_COUNT > 0)) */
+
+/***********************************************************************************/
+/*				    			 End Of File			         				   */
+/***********************************************************************************/
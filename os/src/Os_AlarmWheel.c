@@ -0,0 +1,398 @@
+/**
+ * @file Os_AlarmWheel.c
+ * @author Mahmoud Ismail
+ * @version 1.0.0
+ * @date 19-10-2026
+ * @platform
+ * @variant
+ * @vendor CryptOS
+ * @specification OSEK/VDX
+ * @brief Hierarchical timing wheel alarm queue (OS_ALARM_QUEUE_WHEEL).
+ *
+ * Insert and remove are O(1). A tick expires the level 0 slot of the new time, and
+ * every 2^(L*bits) ticks cascades one slot of level L to the lower levels, each alarm is
+ * cascaded at most OS_ALARM_WHEEL_LEVELS - 1 times during its life.
+ */
+
+/**********************************************************************************/
+/**				    			Include Headers			         				 **/
+/**********************************************************************************/
+#include <Os_kernel.h>
+
+#if ((OS_ALARM_QUEUE == OS_ALARM_QUEUE_WHEEL) && (COUNTER_COUNT > 0))
+
+/***********************************************************************************/
+/*  			    			    Macros				         				   */
+/***********************************************************************************/
+
+#if ((OS_ALARM_WHEEL_SLOT_BITS * OS_ALARM_WHEEL_LEVELS) >= 32U)
+#error The span of the alarm wheel must be below 2^32 ticks!
+#endif /* #if ((OS_ALARM_WHEEL_SLOT_BITS * OS_ALARM_WHEEL_LEVELS) >= 32U) */
+
+/* Slots per level */
+#define OS_WHEEL_SLOTS          (1UL << OS_ALARM_WHEEL_SLOT_BITS)
+#define OS_WHEEL_MASK           (OS_WHEEL_SLOTS - 1UL)
+/* Wheel ticks covered by all the levels */
+#define OS_WHEEL_SPAN           (1UL << (OS_ALARM_WHEEL_SLOT_BITS * OS_ALARM_WHEEL_LEVELS))
+
+/* Wheel of a counter */
+#define OS_WHEEL_OF(Counter)    (&AlarmWheels[(Counter)->OsCounterAlarmsHeadIndex])
+
+/***********************************************************************************/
+/*                        Internal Function Declration                             */
+/***********************************************************************************/
+
+static FUNC(void, OS_CODE) Os_WheelLink
+(
+    P2VAR(Os_Alarm *, AUTOMATIC, OS_VAR) Slot,
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm
+);
+
+static FUNC(void, OS_CODE) Os_WheelUnlink
+(
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm
+);
+
+static FUNC(void, OS_CODE) Os_WheelPlace
+(
+    P2VAR(Os_AlarmWheel, AUTOMATIC, OS_VAR) Wheel,
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm
+);
+
+static FUNC(void, OS_CODE) Os_WheelCascade
+(
+    P2VAR(Os_AlarmWheel, AUTOMATIC, OS_VAR) Wheel,
+    P2VAR(Os_Alarm *, AUTOMATIC, OS_VAR) Slot
+);
+
+/***********************************************************************************/
+/*				    	 External Functions Definition		      				   */
+/***********************************************************************************/
+
+FUNC(void, OS_CODE)
+OS_AlarmQueueInit(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter)
+{
+    P2VAR(Os_AlarmWheel, AUTOMATIC, OS_VAR)
+    Wheel = OS_WHEEL_OF(Counter);
+
+    VAR(uint32, AUTOMATIC)
+    Level;
+
+    VAR(uint32, AUTOMATIC)
+    Index;
+
+    Wheel->Now      = 0U;
+    Wheel->Count    = 0U;
+    Wheel->Overflow = NULL_PTR;
+
+    for (Level = 0U; Level < OS_ALARM_WHEEL_LEVELS; Level++)
+    {
+        for (Index = 0U; Index < OS_WHEEL_SLOTS; Index++)
+        {
+            Wheel->Slots[Level][Index] = NULL_PTR;
+        }
+    }
+}
+
+FUNC(void, OS_CODE)
+OS_AlarmQueueInsert(
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm)
+{
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA)
+    Counter = Alarm->OsAlarmCounterRef;
+
+    P2VAR(Os_AlarmWheel, AUTOMATIC, OS_VAR)
+    Wheel = OS_WHEEL_OF(Counter);
+
+    VAR(uint32, AUTOMATIC)
+    Modulo = (uint32)Counter->OsCounterMaxAllowedValue + 1UL;
+
+    VAR(uint32, AUTOMATIC)
+    Delta;
+
+#if (OS_ALARM_SLACK == STD_ON)
+    OS_AlarmCoalesce(Alarm);
+#endif /* #if (OS_ALARM_SLACK == STD_ON) */
+
+    /* Ticks to the expiry, a whole period if it is the current value */
+    Delta = ((uint32)Alarm->OsAlarmExpiryTime + Modulo - (uint32)Counter->OsCounterCurrentTicks) % Modulo;
+
+    if (0U == Delta)
+    {
+        Delta = Modulo;
+    }
+
+    Alarm->OsAlarmWheelTime = Wheel->Now + Delta;
+    Os_WheelPlace(Wheel, Alarm);
+    Wheel->Count++;
+}
+
+FUNC(void, OS_CODE)
+OS_AlarmQueueRemove(
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm)
+{
+    if (NULL_PTR != Alarm->OsAlarmSlot)
+    {
+        Os_WheelUnlink(Alarm);
+        OS_WHEEL_OF(Alarm->OsAlarmCounterRef)->Count--;
+    }
+}
+
+FUNC(void, OS_CODE)
+OS_AlarmQueueTick(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter)
+{
+    P2VAR(Os_AlarmWheel, AUTOMATIC, OS_VAR)
+    Wheel = OS_WHEEL_OF(Counter);
+
+    P2VAR(Os_Alarm *, AUTOMATIC, OS_VAR)
+    Slot;
+
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA)
+    Alarm;
+
+    VAR(uint32, AUTOMATIC)
+    Level;
+
+    Wheel->Now++;
+
+    /* Level L turns when the low L*bits of the time wrap, the higher levels first */
+    if (0U != Wheel->Count)
+    {
+        if (0U == (Wheel->Now & (OS_WHEEL_SPAN - 1UL)))
+        {
+            Os_WheelCascade(Wheel, &Wheel->Overflow);
+        }
+
+        for (Level = OS_ALARM_WHEEL_LEVELS - 1U; Level > 0U; Level--)
+        {
+            if (0U == (Wheel->Now & ((1UL << (Level * OS_ALARM_WHEEL_SLOT_BITS)) - 1UL)))
+            {
+                Os_WheelCascade(Wheel, &Wheel->Slots[Level][(Wheel->Now >> (Level * OS_ALARM_WHEEL_SLOT_BITS)) & OS_WHEEL_MASK]);
+            }
+        }
+
+        /* Every alarm of the level 0 slot of the new time is due */
+        Slot  = &Wheel->Slots[0][Wheel->Now & OS_WHEEL_MASK];
+        Alarm = *Slot;
+
+        while (NULL_PTR != Alarm)
+        {
+            Os_WheelUnlink(Alarm);
+            Wheel->Count--;
+
+            OS_AlarmExpire(Alarm);
+
+            Alarm = *Slot;
+        }
+    }
+}
+
+FUNC(TickType, OS_CODE)
+OS_AlarmQueueNextExpiry(
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter)
+{
+    P2CONST(Os_AlarmWheel, AUTOMATIC, OS_VAR)
+    Wheel = OS_WHEEL_OF(Counter);
+
+    /* Up to the next turn of level 1, a cascade may bring a nearer alarm to level 0 */
+    VAR(uint32, AUTOMATIC)
+    Limit = OS_WHEEL_SLOTS - (Wheel->Now & OS_WHEEL_MASK);
+
+    VAR(uint32, AUTOMATIC)
+    Ticks = 0U;
+
+    if (0U != Wheel->Count)
+    {
+        for (Ticks = 1U; Ticks < Limit; Ticks++)
+        {
+            if (NULL_PTR != Wheel->Slots[0][(Wheel->Now + Ticks) & OS_WHEEL_MASK])
+            {
+                break;
+            }
+        }
+    }
+
+    return (TickType)Ticks;
+}
+
+FUNC(void, OS_CODE)
+OS_AlarmQueueSkip(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter,
+    CONST(TickType, AUTOMATIC) Ticks)
+{
+    /* No slot is passed: the skipped ticks end before the next expiry or cascade */
+    OS_WHEEL_OF(Counter)->Now += (uint32)Ticks;
+}
+
+FUNC(TickType, OS_CODE)
+OS_AlarmQueueRemaining(
+    P2CONST(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm)
+{
+    return (TickType)(Alarm->OsAlarmWheelTime - OS_WHEEL_OF(Alarm->OsAlarmCounterRef)->Now);
+}
+
+#if (OS_ALARM_SLACK == STD_ON)
+FUNC(TickType, OS_CODE)
+OS_AlarmQueueFindExpiry(
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter,
+    CONST(TickType, AUTOMATIC) From,
+    CONST(TickType, AUTOMATIC) To)
+{
+    P2CONST(Os_AlarmWheel, AUTOMATIC, OS_VAR)
+    Wheel = OS_WHEEL_OF(Counter);
+
+    /* Only the level 0 slots before the next turn of level 1 hold the alarms of one tick,
+       the expiries further away are not shared */
+    VAR(uint32, AUTOMATIC)
+    Limit = OS_WHEEL_SLOTS - (Wheel->Now & OS_WHEEL_MASK);
+
+    VAR(uint32, AUTOMATIC)
+    Ticks;
+
+    VAR(TickType, AUTOMATIC)
+    Found = 0U;
+
+    for (Ticks = (uint32)From; (Ticks <= (uint32)To) && (Ticks < Limit) && (0U == Found); Ticks++)
+    {
+        if (NULL_PTR != Wheel->Slots[0][(Wheel->Now + Ticks) & OS_WHEEL_MASK])
+        {
+            Found = (TickType)Ticks;
+        }
+    }
+
+    return Found;
+}
+#endif /* #if (OS_ALARM_SLACK == STD_ON) */
+
+/***********************************************************************************/
+/*				    	 Internal Functions Definition		      				   */
+/***********************************************************************************/
+
+/**
+ * @brief Appends <Alarm> at the tail of the circular list <Slot>.
+ */
+static FUNC(void, OS_CODE) Os_WheelLink
+(
+    P2VAR(Os_Alarm *, AUTOMATIC, OS_VAR) Slot,
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm
+)
+{
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA)
+    Head = *Slot;
+
+    if (NULL_PTR == Head)
+    {
+        Alarm->OsAlarmNext     = Alarm;
+        Alarm->OsAlarmPrevious = Alarm;
+        *Slot = Alarm;
+    }
+    else
+    {
+        /* The tail is the previous of the head */
+        Alarm->OsAlarmNext     = Head;
+        Alarm->OsAlarmPrevious = Head->OsAlarmPrevious;
+        Head->OsAlarmPrevious->OsAlarmNext = Alarm;
+        Head->OsAlarmPrevious  = Alarm;
+    }
+
+    Alarm->OsAlarmSlot = Slot;
+}
+
+/**
+ * @brief Unlinks <Alarm> from the slot holding it.
+ */
+static FUNC(void, OS_CODE) Os_WheelUnlink
+(
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm
+)
+{
+    P2VAR(Os_Alarm *, AUTOMATIC, OS_VAR)
+    Slot = Alarm->OsAlarmSlot;
+
+    if (Alarm->OsAlarmNext == Alarm)
+    {
+        *Slot = NULL_PTR;
+    }
+    else
+    {
+        Alarm->OsAlarmPrevious->OsAlarmNext = Alarm->OsAlarmNext;
+        Alarm->OsAlarmNext->OsAlarmPrevious = Alarm->OsAlarmPrevious;
+
+        if (*Slot == Alarm)
+        {
+            *Slot = Alarm->OsAlarmNext;
+        }
+    }
+
+    Alarm->OsAlarmNext     = NULL_PTR;
+    Alarm->OsAlarmPrevious = NULL_PTR;
+    Alarm->OsAlarmSlot     = NULL_PTR;
+}
+
+/**
+ * @brief Links <Alarm> in the slot of the lowest level covering its distance to Now.
+ */
+static FUNC(void, OS_CODE) Os_WheelPlace
+(
+    P2VAR(Os_AlarmWheel, AUTOMATIC, OS_VAR) Wheel,
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA) Alarm
+)
+{
+    VAR(uint32, AUTOMATIC)
+    Delta = Alarm->OsAlarmWheelTime - Wheel->Now;
+
+    VAR(uint32, AUTOMATIC)
+    Level = 0U;
+
+    if (Delta >= OS_WHEEL_SPAN)
+    {
+        Os_WheelLink(&Wheel->Overflow, Alarm);
+    }
+    else
+    {
+        while (Delta >= (1UL << ((Level + 1U) * OS_ALARM_WHEEL_SLOT_BITS)))
+        {
+            Level++;
+        }
+
+        Os_WheelLink(&Wheel->Slots[Level][(Alarm->OsAlarmWheelTime >> (Level * OS_ALARM_WHEEL_SLOT_BITS)) & OS_WHEEL_MASK], Alarm);
+    }
+}
+
+/**
+ * @brief Places again the alarms of <Slot> relative to the new time of the wheel.
+ */
+static FUNC(void, OS_CODE) Os_WheelCascade
+(
+    P2VAR(Os_AlarmWheel, AUTOMATIC, OS_VAR) Wheel,
+    P2VAR(Os_Alarm *, AUTOMATIC, OS_VAR) Slot
+)
+{
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA)
+    Alarm = *Slot;
+
+    P2VAR(Os_Alarm, AUTOMATIC, OS_APPL_DATA)
+    Next;
+
+    /* The slot is detached first, an alarm of the overflow list may go back to it */
+    if (NULL_PTR != Alarm)
+    {
+        Alarm->OsAlarmPrevious->OsAlarmNext = NULL_PTR;
+        *Slot = NULL_PTR;
+    }
+
+    while (NULL_PTR != Alarm)
+    {
+        Next = Alarm->OsAlarmNext;
+        Os_WheelPlace(Wheel, Alarm);
+        Alarm = Next;
+    }
+}
+
+#endif /* #if ((OS_ALARM_QUEUE == OS_ALARM_QUEUE_WHEEL) && (COUNTER_COUNT > 0)) */
+
+/***********************************************************************************/
+/*				    			 End Of File			         				   */
+/***********************************************************************************/
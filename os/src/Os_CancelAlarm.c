@@ -1,3 +1,6 @@
+/* Kernel main header file inclusion */
+#include <Os_kernel.h>
+
 /**
  * @brief The system service cancels the alarm <AlarmID>.
  *
@@ -36,9 +39,6 @@ OS_CancelAlarm(
     P2VAR(Os_Alarm, OS_CODE, TYPEDEF)
     Alarm = NULL_PTR;
 
-    VAR(uint8, TYPEDEF)
-    ActiveAlarmsHeadIndex;
-
 #if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
 
     if (AlarmID >= ALARM_COUNT)
@@ -59,14 +59,16 @@ OS_CancelAlarm(
     }
     else
     {
-        /* Get Index */
-        ActiveAlarmsHeadIndex = Alarm->OsAlarmCounterRef->OsCounterAlarmsHeadIndex;
-
         /* Change Alarm State */
         Alarm->OsAlarmState = ALARM_SLEEP;
 
         /* Remove from List */
-        OS_AlarmRemove(&ActiveAlarmsHead[ActiveAlarmsHeadIndex], Alarm);
+        OS_AlarmQueueRemove(Alarm);
+
+#if (OS_COUNTER_TIMER_DRIVER == STD_ON)
+        /* No interrupt for the expiry of the cancelled alarm */
+        OS_CounterTimerProgram(Alarm->OsAlarmCounterRef);
+#endif /* #if (OS_COUNTER_TIMER_DRIVER == STD_ON) */
     }
 #endif  /* (ALARM_COUNT > 0) */
 
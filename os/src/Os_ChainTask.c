@@ -16,7 +16,7 @@
 /**********************************************************************************/
 /**                                   Include Headers                             **/
 /**********************************************************************************/
-#include <OS_kernel.h>
+#include <Os_kernel.h>
 
 
 /***********************************************************************************/
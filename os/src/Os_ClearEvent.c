@@ -24,7 +24,7 @@
 /**********************************************************************************/
 /**				    			Include Headers			         				 **/
 /**********************************************************************************/
-#include <OS_kernel.h>
+#include <Os_kernel.h>
 
 /***********************************************************************************/
 /*  			    			    Macros				         				   */
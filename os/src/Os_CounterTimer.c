@@ -0,0 +1,128 @@
+/**
+ * @file Os_CounterTimer.c
+ * @author Mahmoud Ismail
+ * @version 1.0.0
+ * @date 19-10-2026
+ * @platform
+ * @variant
+ * @vendor CryptOS
+ * @specification OSEK/VDX
+ * @brief Compare timer driver of the system counter (OS_COUNTER_COMPARE_TIMER).
+ *
+ * Counters[0] counts a free-running timer of the port, one counter tick per timer count.
+ * There is no periodic interrupt: the counter is brought up to the timer on demand
+ * (OS_CounterTimerUpdate) and the compare register is programmed for the next alarm
+ * expiry only (OS_CounterTimerProgram). The resolution of the alarms is the one of the
+ * timer, the core is only woken up by the expiries.
+ *
+ * The counts elapsed are the unsigned difference of two timer values: the compare is
+ * programmed at least once per counter period, the timer never laps the counter.
+ *
+ * The timer value of the last update is kept in the time snapshot of the counter: the tasks
+ * reading the counter add the timer counts since then.
+ *
+ * With OS_TICK_DEFERRED the timer is the count of the periodic SysTick (Counters.c) and the
+ * compare interrupt is the deferred expiry handler pended by SysTick: the tick interrupt
+ * only counts, the alarms expire in the handler.
+ */
+
+/**********************************************************************************/
+/**				    			Include Headers			         				 **/
+/**********************************************************************************/
+#include <Os_kernel.h>
+
+#if ((OS_COUNTER_COMPARE_TIMER == STD_ON) && (OS_TICKLESS_IDLE == STD_ON))
+#error OS_COUNTER_COMPARE_TIMER has no periodic tick, OS_TICKLESS_IDLE must be STD_OFF
+#endif /* #if ((OS_COUNTER_COMPARE_TIMER == STD_ON) && (OS_TICKLESS_IDLE == STD_ON)) */
+
+#if ((OS_TICK_DEFERRED == STD_ON) && ((OS_COUNTER_COMPARE_TIMER == STD_ON) || (OS_TICKLESS_IDLE == STD_ON)))
+#error OS_TICK_DEFERRED counts the periodic SysTick, OS_COUNTER_COMPARE_TIMER and OS_TICKLESS_IDLE must be STD_OFF
+#endif /* #if ((OS_TICK_DEFERRED == STD_ON) && ((OS_COUNTER_COMPARE_TIMER == STD_ON) || (OS_TICKLESS_IDLE == STD_ON))) */
+
+#if ((OS_COUNTER_TIMER_DRIVER == STD_ON) && (COUNTER_COUNT > 0))
+
+/***********************************************************************************/
+/*  			    			    Macros				         				   */
+/***********************************************************************************/
+
+/* Counter driven by the timer */
+#define OS_TIMER_COUNTER        (&Counters[0])
+
+/***********************************************************************************/
+/*				    	 External Functions Definition		      				   */
+/***********************************************************************************/
+
+/* Called by StartOS with the alarm queues empty */
+FUNC(void, OS_CODE) OS_CounterTimerInit
+(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter
+)
+{
+    if (OS_TIMER_COUNTER == Counter)
+    {
+        Os_CounterTimerStart();
+
+        Counter->OsCounterTime->OsCounterTimeTimerLast = Os_CounterTimerRead();
+
+        OS_CounterTimerProgram(Counter);
+    }
+}
+
+FUNC(void, OS_CODE) OS_CounterTimerUpdate
+(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter
+)
+{
+    VAR(uint32, AUTOMATIC) Now;
+    VAR(uint32, AUTOMATIC) Elapsed;
+    VAR(boolean, AUTOMATIC) Opened;
+
+    if (OS_TIMER_COUNTER == Counter)
+    {
+        /* The timer reference and the counter value change together for the readers */
+        Opened = OS_CounterTimeBegin(Counter);
+
+        Now     = Os_CounterTimerRead();
+        Elapsed = Now - Counter->OsCounterTime->OsCounterTimeTimerLast;
+
+        Counter->OsCounterTime->OsCounterTimeTimerLast = Now;
+
+        OS_AdvanceHardwareCounter(Counter, (TickType)Elapsed);
+
+        OS_CounterTimeEnd(Counter, Opened);
+    }
+}
+
+FUNC(void, OS_CODE) OS_CounterTimerProgram
+(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter
+)
+{
+    VAR(uint32, AUTOMATIC) Ticks;
+
+    if (OS_TIMER_COUNTER == Counter)
+    {
+        do
+        {
+            OS_CounterTimerUpdate(Counter);
+
+            /* A whole counter period if no alarm or schedule table is active */
+            Ticks = (uint32)OS_CounterNextExpiry(Counter);
+
+            if (0U == Ticks)
+            {
+                Ticks = (uint32)Counter->OsCounterMaxAllowedValue + 1UL;
+            }
+
+            Os_CounterTimerSetCompare(Counter->OsCounterTime->OsCounterTimeTimerLast + Ticks);
+
+            /* The timer reached the compare while it was programmed: catch up and program again */
+        } while ((Os_CounterTimerRead() - Counter->OsCounterTime->OsCounterTimeTimerLast) >= Ticks);
+    }
+}
+
+#endif /* #if ((OS_COUNTER_TIMER_DRIVER == STD_ON) && (COUNTER_COUNT > 0)) */
+
+/***********************************************************************************/
+/*				    			 End Of File			         				   */
+/***********************************************************************************/
@@ -1,3 +1,6 @@
+/* Kernel main header file inclusion */
+#include <Os_kernel.h>
+
 /**
  * @brief The system service GetAlarm returns the relative value in ticks before the alarm <AlarmID> expires.
  *
@@ -34,10 +37,6 @@ OS_GetAlarm(
     ErrorState = E_OK;
 
 #if (ALARM_COUNT > 0)
-    /* Var for current ticks */
-    VAR(TickType, TYPEDEF)
-    CurrentCounterTicks = 0;
-
     /* Create pointer to an instance of Os_Alarm struct*/
     P2VAR(Os_Alarm, OS_CODE, TYPEDEF)
     Alarm = NULL_PTR;
@@ -62,18 +61,19 @@ OS_GetAlarm(
             /* Access struct of <AlarmID> */
             Alarm = &Alarms[AlarmID];
 
-            /* Get current counter value */
-            CurrentCounterTicks = Alarm->OsAlarmCounterRef->OsCounterCurrentTicks;
+#if (OS_COUNTER_TIMER_DRIVER == STD_ON)
+            /* Counts from the current timer value, a single alarm may expire on the way */
+            OS_CounterTimerUpdate(Alarm->OsAlarmCounterRef);
 
-            if (Alarm->OsAlarmExpiryTime >= CurrentCounterTicks)
+            if (Alarm->OsAlarmState == ALARM_SLEEP)
             {
-                /* The relative tick value when the alarm expires - Current counter value */
-                *Tick = Alarm->OsAlarmExpiryTime - CurrentCounterTicks;
+                ErrorState = E_OS_NOFUNC;
             }
             else
+#endif /* #if (OS_COUNTER_TIMER_DRIVER == STD_ON) */
             {
-                /* Overlapping case */
-                *Tick = (Alarm->OsAlarmExpiryTime + (Alarm->OsAlarmCounterRef->OsCounterMaxAllowedValue - CurrentCounterTicks) + 1);
+                /* The relative tick value when the alarm expires, given by the alarm queue */
+                *Tick = OS_AlarmQueueRemaining(Alarm);
             }
         }
 #endif /* (ALARM_COUNT > 0) */
@@ -1,3 +1,6 @@
+/* Kernel main header file inclusion */
+#include <Os_kernel.h>
+
 /**
  * @brief The system service GetAlarmBase reads the alarm base characteristics.
  *
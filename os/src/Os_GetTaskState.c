@@ -19,7 +19,7 @@
 /**********************************************************************************/
 /*                		Include Headers			         	  */
 /**********************************************************************************/
-#include <OS_kernel.h>
+#include <Os_kernel.h>
 /***********************************************************************************/
 /*  			    	 Macros		                                   */
 /***********************************************************************************/
@@ -0,0 +1,78 @@
+/**
+ * @file Os_IntLock.c
+ * @author Mahmoud Ismail
+ * @version 1.0.0
+ * @date 19-10-2026
+ * @platform
+ * @variant
+ * @vendor CryptOS
+ * @specification OSEK/VDX
+ * @brief Lock duration measurement of the interrupt lock services (debug mode).
+ *
+ */
+
+/**********************************************************************************/
+/**				    			Include Headers			         				 **/
+/**********************************************************************************/
+#include <Os_kernel.h>
+#include <Os_kernel_intlock.h>
+
+#if (OS_INT_LOCK_MEASURE == STD_ON)
+
+/***************************************************************************************/
+/*                            External Global Variables                                */
+/***************************************************************************************/
+
+P2VAR(Os_IntLockSiteType, AUTOMATIC, OS_VAR) Os_IntLockSites = NULL_PTR;
+
+/***************************************************************************************/
+/*                              Internal Global Variables                              */
+/***************************************************************************************/
+
+/* Time stamp and call site of the outermost lock of every kind */
+static VAR(uint32, OS_VAR) Os_IntLockStart[OS_INT_LOCK_KINDS];
+static P2VAR(Os_IntLockSiteType, AUTOMATIC, OS_VAR) Os_IntLockSite[OS_INT_LOCK_KINDS];
+
+/***********************************************************************************/
+/*				    	 External Functions Definition		      				   */
+/***********************************************************************************/
+
+/* Called with the interrupts already locked */
+FUNC(void, OS_CODE) OS_IntLockMeasureStart
+(
+	CONST(uint8, AUTOMATIC) Kind,
+	P2VAR(Os_IntLockSiteType, AUTOMATIC, OS_VAR) Site
+)
+{
+	if (FALSE == Site->Registered)
+	{
+		Site->Next       = Os_IntLockSites;
+		Site->Registered = TRUE;
+		Os_IntLockSites  = Site;
+	}
+
+	Site->Count++;
+	Os_IntLockSite[Kind]  = Site;
+	Os_IntLockStart[Kind] = (uint32)OS_TIMESTAMP();
+}
+
+FUNC(void, OS_CODE) OS_IntLockMeasureStop
+(
+	CONST(uint8, AUTOMATIC) Kind
+)
+{
+	VAR(uint32, AUTOMATIC) Duration = (uint32)OS_TIMESTAMP() - Os_IntLockStart[Kind];
+
+	if ((NULL_PTR != Os_IntLockSite[Kind]) && (Duration > Os_IntLockSite[Kind]->MaxDuration))
+	{
+		Os_IntLockSite[Kind]->MaxDuration = Duration;
+	}
+
+	Os_IntLockSite[Kind] = NULL_PTR;
+}
+
+#endif /* #if (OS_INT_LOCK_MEASURE == STD_ON) */
+
+/***********************************************************************************/
+/*				    			 End Of File			         				   */
+/***********************************************************************************/
@@ -0,0 +1,90 @@
+/**
+ * @file Os_Isr.c
+ * @author Mahmoud Ismail
+ * @version 1.0.0
+ * @date 19-10-2026
+ * @platform
+ * @variant
+ * @vendor CryptOS
+ * @specification OSEK/VDX
+ * @brief Entry and exit of the Category 2 ISRs.
+ *
+ */
+
+/**********************************************************************************/
+/**				    			Include Headers			         				 **/
+/**********************************************************************************/
+#include <Os_kernel.h>
+
+/***********************************************************************************/
+/*				    	 External Functions Definition		      				   */
+/***********************************************************************************/
+
+FUNC(void, OS_CODE) OS_IsrEnter
+(
+	void
+)
+{
+#if (OS_TICKLESS_IDLE == STD_ON)
+	/* Woken up from idle: the ticks of the sleep are counted before the body runs */
+	if (0U == Kernel.IsrNestingLevel)
+	{
+		OS_KERNEL_LOCK();
+		OS_TicklessLeave();
+		OS_KERNEL_UNLOCK();
+	}
+#endif /* #if (OS_TICKLESS_IDLE == STD_ON) */
+
+	Kernel.IsrNestingLevel++;
+
+	if (1U == Kernel.IsrNestingLevel)
+	{
+		/* Outermost ISR, keep the state of the interrupted task */
+		Kernel.IsrPreviousState = Kernel.OsState;
+	}
+
+	/*
+		[OSEK_TaskManagment_0045] During interrupt service routines no rescheduling is performed.
+		The services see OS_STATE_CAT2 and only set Kernel.SchedulerNeeded.
+	*/
+	Kernel.OsState = OS_STATE_CAT2;
+}
+
+FUNC(void, OS_CODE) OS_IsrExit
+(
+	void
+)
+{
+	Kernel.IsrNestingLevel--;
+
+	if (0U == Kernel.IsrNestingLevel)
+	{
+		Kernel.OsState = Kernel.IsrPreviousState;
+
+		/*
+			One rescheduling for all the requests of the nested ISRs. The dispatcher
+			waiting in idle (OS_CONTEXTLESS_IDLE) reschedules when the ISR returns to it.
+		*/
+		if ((TRUE == Kernel.SchedulerNeeded) && (FALSE == Kernel.IdleWaiting))
+		{
+			OS_ISR_DISPATCH();
+		}
+#if (OS_TICKLESS_IDLE == STD_ON)
+		else if ((NULL_PTR != Kernel.TaskRunning) && (IdleTaskId == Kernel.TaskRunning->TaskID))
+		{
+			/* Still idle, sleep again until the next expiry */
+			OS_KERNEL_LOCK();
+			OS_TicklessEnter();
+			OS_KERNEL_UNLOCK();
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+#endif /* #if (OS_TICKLESS_IDLE == STD_ON) */
+	}
+}
+
+/***********************************************************************************/
+/*				    			 End Of File			         				   */
+/***********************************************************************************/
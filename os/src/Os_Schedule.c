@@ -72,6 +72,13 @@
  * @{
  */
 
+#if (OS_CONTEXTLESS_IDLE == STD_ON)
+static FUNC(void, OS_CODE) Os_IdleWait
+(
+	void
+);
+#endif /* #if (OS_CONTEXTLESS_IDLE == STD_ON) */
+
 
 
 /***********************************************************************************/
@@ -192,11 +199,20 @@ FUNC(void,OS_CODE) Kern_Schedule
 	else if((NULL_PTR == Kernel.TaskRunning) && (NULL_PTR ==  Kernel.TaskQueueHead))
 	{
 		/* if no task to be running */
+#if (OS_CONTEXTLESS_IDLE == STD_ON)
+		/* No idle context, the first task made ready by an ISR is dispatched directly */
+		Os_IdleWait();
+#else
 		Kernel.TaskRunning = &Tasks[IdleTaskId];
 		Os_CreateStackFrame();
+#if (OS_TICKLESS_IDLE == STD_ON)
+		/* No periodic tick while idle, the tick source fires on the next alarm expiry */
+		OS_TicklessEnter();
+#endif /* #if (OS_TICKLESS_IDLE == STD_ON) */
 		Kernel.NewContext = FALSE;
 		Kernel.DispatcherNeeded = TRUE;
 		TaskSwitch = FALSE;
+#endif /* #if (OS_CONTEXTLESS_IDLE == STD_ON) */
 	}
 	else
 	{
@@ -225,7 +241,11 @@ FUNC(void,OS_CODE) Kern_Schedule
 				[OSEK_TaskManagment_0031] Preempted task is considered to be the first (oldest) 
 				task in the ready list of its current priority.
 			*/
-			QueueReturn = ReadyQueueAddFront(Kernel.TaskRunning);	
+			if (IdleTaskId != Kernel.TaskRunning->TaskID)
+			{
+				/* The idle task has no ready queue, it is recreated whenever nothing is ready */
+				QueueReturn = ReadyQueueAddFront(Kernel.TaskRunning);
+			}
 
 			Kernel.TaskPreempted = Kernel.TaskRunning;			
 				
@@ -361,6 +381,36 @@ void OS_SetRunningTask
 
 
 
+#if (OS_CONTEXTLESS_IDLE == STD_ON)
+/**
+ * @brief Sleeps in the dispatcher until a task is ready, called with the kernel locked.
+ *
+ * Kernel.TaskRunning stays NULL_PTR: there is no idle task and no context is saved or
+ * restored for the sleep. The ISRs taken during OS_IDLE_WAIT() do not request the
+ * dispatcher, the loop finds their ready tasks when they return.
+ */
+static FUNC(void, OS_CODE) Os_IdleWait
+(
+	void
+)
+{
+	Kernel.IdleWaiting = TRUE;
+
+	while (NULL_PTR == Kernel.TaskQueueHead)
+	{
+#if (OS_TICKLESS_IDLE == STD_ON)
+		/* No periodic tick while idle, the tick source fires on the next alarm expiry */
+		OS_TicklessEnter();
+#endif /* #if (OS_TICKLESS_IDLE == STD_ON) */
+
+		/* Unlocks the kernel, sleeps until an interrupt was handled and locks it again */
+		OS_IDLE_WAIT();
+	}
+
+	Kernel.IdleWaiting = FALSE;
+}
+#endif /* #if (OS_CONTEXTLESS_IDLE == STD_ON) */
+
 /** @} */  /*End of InternalFunctionDefinition*/
 
 
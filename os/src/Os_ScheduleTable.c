@@ -0,0 +1,1056 @@
+/**
+ * @file Os_ScheduleTable.c
+ * @author Mahmoud Ismail
+ * @version 1.0.0
+ * @date 19-10-2026
+ * @platform
+ * @variant
+ * @vendor CryptOS
+ * @specification AUTOSAR OS
+ * @brief Schedule tables driven by a counter.
+ *
+ * The running tables of a counter are linked in ScheduleTablesHead[OsCounterAlarmsHeadIndex].
+ * On every tick of the counter the current value is compared with the expiry time of each
+ * running table, a table is only walked when it is due: the actions of its expiry point are
+ * done, the cursor moves to the next point and the expiry time advances by the distance
+ * to it. After the last point the final delay runs to the end of the round, where the
+ * table repeats, stops or hands over to the table chained by NextScheduleTable.
+ *
+ * Explicit synchronisation only changes these delays: SyncScheduleTable measures the
+ * deviation of the position of the table from the value supplied, and every following
+ * expiry point corrects up to its OsExpiryPointMaxShorten / OsExpiryPointMaxLengthen
+ * of it. The counter and its tick are not touched.
+ */
+
+/**********************************************************************************/
+/**				    			Include Headers			         				 **/
+/**********************************************************************************/
+#include <Os_kernel.h>
+
+#if (SCHEDULE_TABLE_COUNT > 0)
+
+/***********************************************************************************/
+/*  			    			    Macros				         				   */
+/***********************************************************************************/
+
+/* Running tables of a counter */
+#define OS_SCHEDTBL_HEAD_OF(Counter)    (&ScheduleTablesHead[(Counter)->OsCounterAlarmsHeadIndex])
+
+/***********************************************************************************/
+/*                        Internal Function Declration                             */
+/***********************************************************************************/
+
+static FUNC(void, OS_CODE) Os_ScheduleTableStart
+(
+    P2VAR(Os_ScheduleTable, AUTOMATIC, OS_VAR) Table,
+    CONST(TickType, AUTOMATIC) Start
+);
+
+static FUNC(void, OS_CODE) Os_ScheduleTableStop
+(
+    P2VAR(Os_ScheduleTable, AUTOMATIC, OS_VAR) Table
+);
+
+static FUNC(void, OS_CODE) Os_ScheduleTableExpire
+(
+    P2VAR(Os_ScheduleTable, AUTOMATIC, OS_VAR) Table
+);
+
+static FUNC(void, OS_CODE) Os_ScheduleTableFireActions
+(
+    P2CONST(Os_ExpiryPoint, AUTOMATIC, OS_CONST) Point
+);
+
+static FUNC(TickType, OS_CODE) Os_ScheduleTableAdjust
+(
+    P2VAR(Os_ScheduleTable, AUTOMATIC, OS_VAR) Table,
+    P2CONST(Os_ExpiryPoint, AUTOMATIC, OS_CONST) Point,
+    CONST(TickType, AUTOMATIC) Delay
+);
+
+static FUNC(TickType, OS_CODE) Os_ScheduleTablePosition
+(
+    P2CONST(Os_ScheduleTable, AUTOMATIC, OS_VAR) Table
+);
+
+/***********************************************************************************/
+/*				    	 External Functions Definition		      				   */
+/***********************************************************************************/
+
+FUNC(void, OS_CODE) OS_ScheduleTableInit
+(
+    void
+)
+{
+    VAR(ScheduleTableType, AUTOMATIC) TableID;
+    VAR(CounterType, AUTOMATIC) CounterID;
+
+    for (CounterID = 0U; CounterID < COUNTER_COUNT; CounterID++)
+    {
+        *OS_SCHEDTBL_HEAD_OF(&Counters[CounterID]) = NULL_PTR;
+    }
+
+    for (TableID = 0U; TableID < SCHEDULE_TABLE_COUNT; TableID++)
+    {
+        ScheduleTables[TableID].OsScheduleTableState     = SCHEDULETABLE_STOPPED;
+        ScheduleTables[TableID].OsScheduleTableNext      = NULL_PTR;
+        ScheduleTables[TableID].OsScheduleTableNextTable = NULL_PTR;
+    }
+}
+
+FUNC(void, OS_CODE) OS_ScheduleTableTick
+(
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter
+)
+{
+    P2VAR(Os_ScheduleTable, AUTOMATIC, OS_VAR) Table = *OS_SCHEDTBL_HEAD_OF(Counter);
+    P2VAR(Os_ScheduleTable, AUTOMATIC, OS_VAR) Next;
+
+    while (NULL_PTR != Table)
+    {
+        /* Read first, the table leaves the list when it stops */
+        Next = Table->OsScheduleTableNext;
+
+        if (Counter->OsCounterCurrentTicks == Table->OsScheduleTableExpiryTime)
+        {
+            Os_ScheduleTableExpire(Table);
+        }
+
+        Table = Next;
+    }
+}
+
+FUNC(TickType, OS_CODE) OS_ScheduleTableNextExpiry
+(
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter
+)
+{
+    P2CONST(Os_ScheduleTable, AUTOMATIC, OS_VAR) Table = *OS_SCHEDTBL_HEAD_OF(Counter);
+
+    VAR(uint32, AUTOMATIC) Modulo = (uint32)Counter->OsCounterMaxAllowedValue + 1UL;
+    VAR(uint32, AUTOMATIC) Ticks;
+    VAR(uint32, AUTOMATIC) Next = 0U;
+
+    while (NULL_PTR != Table)
+    {
+        /* An expiry time equal to the current value is a whole counter period away */
+        Ticks = ((uint32)Table->OsScheduleTableExpiryTime + Modulo - (uint32)Counter->OsCounterCurrentTicks) % Modulo;
+
+        if (0U == Ticks)
+        {
+            Ticks = Modulo;
+        }
+
+        if ((0U == Next) || (Ticks < Next))
+        {
+            Next = Ticks;
+        }
+
+        Table = Table->OsScheduleTableNext;
+    }
+
+    return (TickType)Next;
+}
+
+#endif /* #if (SCHEDULE_TABLE_COUNT > 0) */
+
+/**
+ * @brief This service starts a schedule table relative to the current counter value.
+ *
+ * @service name    OS_StartScheduleTableRel
+ * @syntax          FUNC(StatusType, OS_CODE) OS_StartScheduleTableRel
+ *                  (
+ *                      CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID,
+ *                      CONST(TickType, AUTOMATIC) Offset
+ *                  );
+ * @service ID  -
+ * @sync/async  Synchronous
+ * @reentrancy  Reentrant
+ * @param[in]  ScheduleTableID    Schedule table to be started.
+ * @param[in]  Offset             Ticks from now to the start of the table.
+ * @param[out] -
+ * @return     StatusType     Indicates the error status
+ *             Standard:
+ *                  • E_OK          No error
+ *                  • E_OS_STATE    The schedule table was already started
+ *             Extended:
+ *                  • E_OS_ID       The ScheduleTableID was not valid
+ *                  • E_OS_VALUE    Offset is 0 or greater than OsCounterMaxAllowedValue
+ *                                  minus the offset of the first expiry point
+ * @see       OS_StartScheduleTableAbs
+ * @note      The first expiry point is processed <Offset> + its own offset ticks from now.
+ * @warning   -
+ */
+FUNC(StatusType, OS_CODE) OS_StartScheduleTableRel
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID,
+    CONST(TickType, AUTOMATIC) Offset
+)
+{
+    VAR(StatusType, AUTOMATIC) ErrorState = E_OK;
+
+#if (SCHEDULE_TABLE_COUNT > 0)
+    P2VAR(Os_ScheduleTable, AUTOMATIC, OS_VAR) Table;
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter;
+
+#if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
+    if (ScheduleTableID >= SCHEDULE_TABLE_COUNT)
+    {
+        ErrorState = E_OS_ID;
+    }
+    else if ((0U == Offset) ||
+             (Offset > (ScheduleTables[ScheduleTableID].OsScheduleTableCounterRef->OsCounterMaxAllowedValue -
+                        ScheduleTables[ScheduleTableID].OsScheduleTableExpiryPoints[0].OsExpiryPointOffset)))
+    {
+        ErrorState = E_OS_VALUE;
+    }
+    else
+#endif /* (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED) */
+    if (SCHEDULETABLE_STOPPED != ScheduleTables[ScheduleTableID].OsScheduleTableState)
+    {
+        ErrorState = E_OS_STATE;
+    }
+    else
+    {
+        Table   = &ScheduleTables[ScheduleTableID];
+        Counter = Table->OsScheduleTableCounterRef;
+
+#if (OS_COUNTER_TIMER_DRIVER == STD_ON)
+        /* The offset counts from the current timer value */
+        OS_CounterTimerUpdate(Counter);
+#endif /* #if (OS_COUNTER_TIMER_DRIVER == STD_ON) */
+
+        Os_ScheduleTableStart(Table, (TickType)(((uint32)Counter->OsCounterCurrentTicks + Offset) %
+                                                ((uint32)Counter->OsCounterMaxAllowedValue + 1UL)));
+
+#if (OS_COUNTER_TIMER_DRIVER == STD_ON)
+        OS_CounterTimerProgram(Counter);
+#endif /* #if (OS_COUNTER_TIMER_DRIVER == STD_ON) */
+    }
+#else
+    (void)ScheduleTableID;
+    (void)Offset;
+
+    /* No schedule table configured */
+    ErrorState = E_OS_ID;
+#endif /* #if (SCHEDULE_TABLE_COUNT > 0) */
+
+    return ErrorState;
+}
+
+/**
+ * @brief This service starts a schedule table at an absolute counter value.
+ *
+ * @service name    OS_StartScheduleTableAbs
+ * @syntax          FUNC(StatusType, OS_CODE) OS_StartScheduleTableAbs
+ *                  (
+ *                      CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID,
+ *                      CONST(TickType, AUTOMATIC) Start
+ *                  );
+ * @service ID  -
+ * @sync/async  Synchronous
+ * @reentrancy  Reentrant
+ * @param[in]  ScheduleTableID    Schedule table to be started.
+ * @param[in]  Start              Counter value of the start of the table.
+ * @param[out] -
+ * @return     StatusType     Indicates the error status
+ *             Standard:
+ *                  • E_OK          No error
+ *                  • E_OS_STATE    The schedule table was already started
+ *             Extended:
+ *                  • E_OS_ID       The ScheduleTableID was not valid
+ *                  • E_OS_VALUE    Start is greater than OsCounterMaxAllowedValue
+ * @see       OS_StartScheduleTableRel
+ * @note      A start at the current counter value begins a whole counter period later.
+ * @warning   -
+ */
+FUNC(StatusType, OS_CODE) OS_StartScheduleTableAbs
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID,
+    CONST(TickType, AUTOMATIC) Start
+)
+{
+    VAR(StatusType, AUTOMATIC) ErrorState = E_OK;
+
+#if (SCHEDULE_TABLE_COUNT > 0)
+    P2VAR(Os_ScheduleTable, AUTOMATIC, OS_VAR) Table;
+
+#if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
+    if (ScheduleTableID >= SCHEDULE_TABLE_COUNT)
+    {
+        ErrorState = E_OS_ID;
+    }
+    else if (Start > ScheduleTables[ScheduleTableID].OsScheduleTableCounterRef->OsCounterMaxAllowedValue)
+    {
+        ErrorState = E_OS_VALUE;
+    }
+    else
+#endif /* (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED) */
+    if (SCHEDULETABLE_STOPPED != ScheduleTables[ScheduleTableID].OsScheduleTableState)
+    {
+        ErrorState = E_OS_STATE;
+    }
+    else
+    {
+        Table = &ScheduleTables[ScheduleTableID];
+
+#if (OS_COUNTER_TIMER_DRIVER == STD_ON)
+        /* <Start> is placed relative to the current timer value */
+        OS_CounterTimerUpdate(Table->OsScheduleTableCounterRef);
+#endif /* #if (OS_COUNTER_TIMER_DRIVER == STD_ON) */
+
+        Os_ScheduleTableStart(Table, Start);
+
+#if (OS_COUNTER_TIMER_DRIVER == STD_ON)
+        OS_CounterTimerProgram(Table->OsScheduleTableCounterRef);
+#endif /* #if (OS_COUNTER_TIMER_DRIVER == STD_ON) */
+    }
+#else
+    (void)ScheduleTableID;
+    (void)Start;
+
+    /* No schedule table configured */
+    ErrorState = E_OS_ID;
+#endif /* #if (SCHEDULE_TABLE_COUNT > 0) */
+
+    return ErrorState;
+}
+
+/**
+ * @brief This service stops a schedule table, the actions not yet done are dropped.
+ *
+ * @service name    OS_StopScheduleTable
+ * @syntax          FUNC(StatusType, OS_CODE) OS_StopScheduleTable
+ *                  (
+ *                      CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID
+ *                  );
+ * @service ID  -
+ * @sync/async  Synchronous
+ * @reentrancy  Reentrant
+ * @param[in]  ScheduleTableID    Schedule table to be stopped.
+ * @param[out] -
+ * @return     StatusType     Indicates the error status
+ *             Standard:
+ *                  • E_OK          No error
+ *                  • E_OS_NOFUNC   The schedule table was not started
+ *             Extended:
+ *                  • E_OS_ID       The ScheduleTableID was not valid
+ * @see       OS_NextScheduleTable
+ * @note      A table chained to the stopped one is stopped as well, a table waiting in
+ *            SCHEDULETABLE_NEXT is removed from the table it follows.
+ * @warning   -
+ */
+FUNC(StatusType, OS_CODE) OS_StopScheduleTable
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID
+)
+{
+    VAR(StatusType, AUTOMATIC) ErrorState = E_OK;
+
+#if (SCHEDULE_TABLE_COUNT > 0)
+    P2VAR(Os_ScheduleTable, AUTOMATIC, OS_VAR) Table;
+    VAR(ScheduleTableType, AUTOMATIC) TableID;
+
+#if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
+    if (ScheduleTableID >= SCHEDULE_TABLE_COUNT)
+    {
+        ErrorState = E_OS_ID;
+    }
+    else
+#endif /* (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED) */
+    if (SCHEDULETABLE_STOPPED == ScheduleTables[ScheduleTableID].OsScheduleTableState)
+    {
+        ErrorState = E_OS_NOFUNC;
+    }
+    else
+    {
+        Table = &ScheduleTables[ScheduleTableID];
+
+        if (SCHEDULETABLE_NEXT == Table->OsScheduleTableState)
+        {
+            /* Not running yet, only the link from the table it follows */
+            for (TableID = 0U; TableID < SCHEDULE_TABLE_COUNT; TableID++)
+            {
+                if (Table == ScheduleTables[TableID].OsScheduleTableNextTable)
+                {
+                    ScheduleTables[TableID].OsScheduleTableNextTable = NULL_PTR;
+                }
+            }
+
+            Table->OsScheduleTableState = SCHEDULETABLE_STOPPED;
+        }
+        else
+        {
+            if (NULL_PTR != Table->OsScheduleTableNextTable)
+            {
+                Table->OsScheduleTableNextTable->OsScheduleTableState = SCHEDULETABLE_STOPPED;
+                Table->OsScheduleTableNextTable = NULL_PTR;
+            }
+
+            Os_ScheduleTableStop(Table);
+
+#if (OS_COUNTER_TIMER_DRIVER == STD_ON)
+            /* No interrupt for the next expiry point of the stopped table */
+            OS_CounterTimerProgram(Table->OsScheduleTableCounterRef);
+#endif /* #if (OS_COUNTER_TIMER_DRIVER == STD_ON) */
+        }
+    }
+#else
+    (void)ScheduleTableID;
+
+    /* No schedule table configured */
+    ErrorState = E_OS_ID;
+#endif /* #if (SCHEDULE_TABLE_COUNT > 0) */
+
+    return ErrorState;
+}
+
+/**
+ * @brief This service starts a schedule table at the end of the round of a running one.
+ *
+ * @service name    OS_NextScheduleTable
+ * @syntax          FUNC(StatusType, OS_CODE) OS_NextScheduleTable
+ *                  (
+ *                      CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID_From,
+ *                      CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID_To
+ *                  );
+ * @service ID  -
+ * @sync/async  Synchronous
+ * @reentrancy  Reentrant
+ * @param[in]  ScheduleTableID_From   Running schedule table.
+ * @param[in]  ScheduleTableID_To     Schedule table started at the end of <From>.
+ * @param[out] -
+ * @return     StatusType     Indicates the error status
+ *             Standard:
+ *                  • E_OK          No error
+ *                  • E_OS_NOFUNC   <From> is not running
+ *                  • E_OS_STATE    <To> is already started
+ *             Extended:
+ *                  • E_OS_ID       An ID was not valid or the tables use different counters
+ * @see       OS_StopScheduleTable
+ * @note      A table chained before to <From> is stopped and replaced by <To>.
+ * @warning   -
+ */
+FUNC(StatusType, OS_CODE) OS_NextScheduleTable
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID_From,
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID_To
+)
+{
+    VAR(StatusType, AUTOMATIC) ErrorState = E_OK;
+
+#if (SCHEDULE_TABLE_COUNT > 0)
+    P2VAR(Os_ScheduleTable, AUTOMATIC, OS_VAR) From;
+
+#if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
+    if ((ScheduleTableID_From >= SCHEDULE_TABLE_COUNT) || (ScheduleTableID_To >= SCHEDULE_TABLE_COUNT))
+    {
+        ErrorState = E_OS_ID;
+    }
+    else if (ScheduleTables[ScheduleTableID_From].OsScheduleTableCounterRef !=
+             ScheduleTables[ScheduleTableID_To].OsScheduleTableCounterRef)
+    {
+        ErrorState = E_OS_ID;
+    }
+    else
+#endif /* (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED) */
+    if ((SCHEDULETABLE_RUNNING != ScheduleTables[ScheduleTableID_From].OsScheduleTableState) &&
+        (SCHEDULETABLE_RUNNING_AND_SYNCHRONOUS != ScheduleTables[ScheduleTableID_From].OsScheduleTableState))
+    {
+        ErrorState = E_OS_NOFUNC;
+    }
+    else if (SCHEDULETABLE_STOPPED != ScheduleTables[ScheduleTableID_To].OsScheduleTableState)
+    {
+        ErrorState = E_OS_STATE;
+    }
+    else
+    {
+        From = &ScheduleTables[ScheduleTableID_From];
+
+        if (NULL_PTR != From->OsScheduleTableNextTable)
+        {
+            From->OsScheduleTableNextTable->OsScheduleTableState = SCHEDULETABLE_STOPPED;
+        }
+
+        From->OsScheduleTableNextTable = &ScheduleTables[ScheduleTableID_To];
+        ScheduleTables[ScheduleTableID_To].OsScheduleTableState = SCHEDULETABLE_NEXT;
+    }
+#else
+    (void)ScheduleTableID_From;
+    (void)ScheduleTableID_To;
+
+    /* No schedule table configured */
+    ErrorState = E_OS_ID;
+#endif /* #if (SCHEDULE_TABLE_COUNT > 0) */
+
+    return ErrorState;
+}
+
+/**
+ * @brief This service returns the state of a schedule table.
+ *
+ * @service name    OS_GetScheduleTableStatus
+ * @syntax          FUNC(StatusType, OS_CODE) OS_GetScheduleTableStatus
+ *                  (
+ *                      CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID,
+ *                      ScheduleTableStatusRefType ScheduleStatus
+ *                  );
+ * @service ID  -
+ * @sync/async  Synchronous
+ * @reentrancy  Reentrant
+ * @param[in]  ScheduleTableID    Schedule table.
+ * @param[out] ScheduleStatus     SCHEDULETABLE_xxx state of the table.
+ * @return     StatusType     Indicates the error status
+ *             Standard:
+ *                  • E_OK          No error
+ *             Extended:
+ *                  • E_OS_ID       The ScheduleTableID was not valid
+ * @see       -
+ * @note      -
+ * @warning   -
+ */
+FUNC(StatusType, OS_CODE) OS_GetScheduleTableStatus
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID,
+    ScheduleTableStatusRefType ScheduleStatus
+)
+{
+    VAR(StatusType, AUTOMATIC) ErrorState = E_OK;
+
+#if (SCHEDULE_TABLE_COUNT > 0)
+#if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
+    if (ScheduleTableID >= SCHEDULE_TABLE_COUNT)
+    {
+        ErrorState = E_OS_ID;
+    }
+    else
+#endif /* (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED) */
+    {
+        *ScheduleStatus = ScheduleTables[ScheduleTableID].OsScheduleTableState;
+    }
+#else
+    (void)ScheduleTableID;
+    (void)ScheduleStatus;
+
+    /* No schedule table configured */
+    ErrorState = E_OS_ID;
+#endif /* #if (SCHEDULE_TABLE_COUNT > 0) */
+
+    return ErrorState;
+}
+
+/**
+ * @brief This service starts an explicitly synchronised schedule table on its first
+ *        synchronisation value.
+ *
+ * @service name    OS_StartScheduleTableSynchron
+ * @syntax          FUNC(StatusType, OS_CODE) OS_StartScheduleTableSynchron
+ *                  (
+ *                      CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID
+ *                  );
+ * @service ID  -
+ * @sync/async  Synchronous
+ * @reentrancy  Reentrant
+ * @param[in]  ScheduleTableID    Schedule table to be started.
+ * @param[out] -
+ * @return     StatusType     Indicates the error status
+ *             Standard:
+ *                  • E_OK          No error
+ *                  • E_OS_STATE    The schedule table was already started
+ *             Extended:
+ *                  • E_OS_ID       The ScheduleTableID was not valid or the table is not
+ *                                  explicitly synchronised
+ * @see       OS_SyncScheduleTable
+ * @note      The table stays SCHEDULETABLE_WAITING, no expiry point is processed before
+ *            the first SyncScheduleTable.
+ * @warning   -
+ */
+FUNC(StatusType, OS_CODE) OS_StartScheduleTableSynchron
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID
+)
+{
+    VAR(StatusType, AUTOMATIC) ErrorState = E_OK;
+
+#if (SCHEDULE_TABLE_COUNT > 0)
+#if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
+    if (ScheduleTableID >= SCHEDULE_TABLE_COUNT)
+    {
+        ErrorState = E_OS_ID;
+    }
+    else if (SCHEDULETABLE_SYNC_EXPLICIT != ScheduleTables[ScheduleTableID].OsScheduleTableSyncStrategy)
+    {
+        ErrorState = E_OS_ID;
+    }
+    else
+#endif /* (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED) */
+    if (SCHEDULETABLE_STOPPED != ScheduleTables[ScheduleTableID].OsScheduleTableState)
+    {
+        ErrorState = E_OS_STATE;
+    }
+    else
+    {
+        ScheduleTables[ScheduleTableID].OsScheduleTableState = SCHEDULETABLE_WAITING;
+    }
+#else
+    (void)ScheduleTableID;
+
+    /* No schedule table configured */
+    ErrorState = E_OS_ID;
+#endif /* #if (SCHEDULE_TABLE_COUNT > 0) */
+
+    return ErrorState;
+}
+
+/**
+ * @brief This service supplies the synchronisation value of a schedule table.
+ *
+ * @service name    OS_SyncScheduleTable
+ * @syntax          FUNC(StatusType, OS_CODE) OS_SyncScheduleTable
+ *                  (
+ *                      CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID,
+ *                      CONST(TickType, AUTOMATIC) Value
+ *                  );
+ * @service ID  -
+ * @sync/async  Synchronous
+ * @reentrancy  Reentrant
+ * @param[in]  ScheduleTableID    Schedule table to be synchronised.
+ * @param[in]  Value              Position the table should have now, in
+ *                                [0, OsScheduleTableDuration).
+ * @param[out] -
+ * @return     StatusType     Indicates the error status
+ *             Standard:
+ *                  • E_OK          No error
+ *                  • E_OS_STATE    The schedule table is stopped or waits for the end of another one
+ *             Extended:
+ *                  • E_OS_ID       The ScheduleTableID was not valid or the table is not
+ *                                  explicitly synchronised
+ *                  • E_OS_VALUE    Value is not below the duration of the table
+ * @see       OS_SetScheduleTableAsync
+ * @note      A SCHEDULETABLE_WAITING table starts its round <Duration - Value> ticks from
+ *            now. A running table records its deviation from <Value>, corrected by the
+ *            following expiry points, and reports SCHEDULETABLE_RUNNING_AND_SYNCHRONOUS
+ *            while the deviation is within OsScheduleTblExplicitPrecision.
+ * @warning   -
+ */
+FUNC(StatusType, OS_CODE) OS_SyncScheduleTable
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID,
+    CONST(TickType, AUTOMATIC) Value
+)
+{
+    VAR(StatusType, AUTOMATIC) ErrorState = E_OK;
+
+#if (SCHEDULE_TABLE_COUNT > 0)
+    P2VAR(Os_ScheduleTable, AUTOMATIC, OS_VAR) Table;
+    P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter;
+    VAR(sint32, AUTOMATIC) Duration;
+    VAR(sint32, AUTOMATIC) Deviation;
+    VAR(uint32, AUTOMATIC) Precision;
+
+#if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
+    if (ScheduleTableID >= SCHEDULE_TABLE_COUNT)
+    {
+        ErrorState = E_OS_ID;
+    }
+    else if (SCHEDULETABLE_SYNC_EXPLICIT != ScheduleTables[ScheduleTableID].OsScheduleTableSyncStrategy)
+    {
+        ErrorState = E_OS_ID;
+    }
+    else if (Value >= ScheduleTables[ScheduleTableID].OsScheduleTableDuration)
+    {
+        ErrorState = E_OS_VALUE;
+    }
+    else
+#endif /* (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED) */
+    if ((SCHEDULETABLE_STOPPED == ScheduleTables[ScheduleTableID].OsScheduleTableState) ||
+        (SCHEDULETABLE_NEXT == ScheduleTables[ScheduleTableID].OsScheduleTableState))
+    {
+        ErrorState = E_OS_STATE;
+    }
+    else
+    {
+        Table     = &ScheduleTables[ScheduleTableID];
+        Counter   = Table->OsScheduleTableCounterRef;
+        Duration  = (sint32)Table->OsScheduleTableDuration;
+        Precision = (uint32)Table->OsScheduleTblExplicitPrecision;
+
+#if (OS_COUNTER_TIMER_DRIVER == STD_ON)
+        /* The position is measured at the current timer value */
+        OS_CounterTimerUpdate(Counter);
+#endif /* #if (OS_COUNTER_TIMER_DRIVER == STD_ON) */
+
+        if (SCHEDULETABLE_WAITING == Table->OsScheduleTableState)
+        {
+            /* The round starts where the synchronisation value reaches the duration */
+            Os_ScheduleTableStart(Table, (TickType)(((uint32)Counter->OsCounterCurrentTicks + (uint32)(Duration - (sint32)Value)) %
+                                                    ((uint32)Counter->OsCounterMaxAllowedValue + 1UL)));
+
+            Table->OsScheduleTableSynchronised = TRUE;
+            Table->OsScheduleTableState = SCHEDULETABLE_RUNNING_AND_SYNCHRONOUS;
+        }
+        else
+        {
+            /* Shortest way round: ahead (> 0) or behind (< 0) by at most half a round */
+            Deviation = ((sint32)Os_ScheduleTablePosition(Table) - (sint32)Value) % Duration;
+            if (Deviation > (Duration / 2))
+            {
+                Deviation -= Duration;
+            }
+            else if (Deviation <= -(Duration / 2))
+            {
+                Deviation += Duration;
+            }
+            else
+            {
+                /* Already the shortest */
+            }
+
+            Table->OsScheduleTableDeviation    = Deviation;
+            Table->OsScheduleTableSynchronised = TRUE;
+
+            if (((Deviation >= 0) && ((uint32)Deviation <= Precision)) ||
+                ((Deviation < 0) && ((uint32)(-Deviation) <= Precision)))
+            {
+                Table->OsScheduleTableState = SCHEDULETABLE_RUNNING_AND_SYNCHRONOUS;
+            }
+            else
+            {
+                Table->OsScheduleTableState = SCHEDULETABLE_RUNNING;
+            }
+        }
+
+#if (OS_COUNTER_TIMER_DRIVER == STD_ON)
+        OS_CounterTimerProgram(Counter);
+#endif /* #if (OS_COUNTER_TIMER_DRIVER == STD_ON) */
+    }
+#else
+    (void)ScheduleTableID;
+    (void)Value;
+
+    /* No schedule table configured */
+    ErrorState = E_OS_ID;
+#endif /* #if (SCHEDULE_TABLE_COUNT > 0) */
+
+    return ErrorState;
+}
+
+/**
+ * @brief This service stops the synchronisation of a schedule table.
+ *
+ * @service name    OS_SetScheduleTableAsync
+ * @syntax          FUNC(StatusType, OS_CODE) OS_SetScheduleTableAsync
+ *                  (
+ *                      CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID
+ *                  );
+ * @service ID  -
+ * @sync/async  Synchronous
+ * @reentrancy  Reentrant
+ * @param[in]  ScheduleTableID    Schedule table.
+ * @param[out] -
+ * @return     StatusType     Indicates the error status
+ *             Standard:
+ *                  • E_OK          No error
+ *                  • E_OS_STATE    The schedule table is not running
+ *             Extended:
+ *                  • E_OS_ID       The ScheduleTableID was not valid or the table is not
+ *                                  explicitly synchronised
+ * @see       OS_SyncScheduleTable
+ * @note      The deviation left is dropped, the table runs on SCHEDULETABLE_RUNNING until
+ *            the next SyncScheduleTable.
+ * @warning   -
+ */
+FUNC(StatusType, OS_CODE) OS_SetScheduleTableAsync
+(
+    CONST(ScheduleTableType, AUTOMATIC) ScheduleTableID
+)
+{
+    VAR(StatusType, AUTOMATIC) ErrorState = E_OK;
+
+#if (SCHEDULE_TABLE_COUNT > 0)
+#if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
+    if (ScheduleTableID >= SCHEDULE_TABLE_COUNT)
+    {
+        ErrorState = E_OS_ID;
+    }
+    else if (SCHEDULETABLE_SYNC_EXPLICIT != ScheduleTables[ScheduleTableID].OsScheduleTableSyncStrategy)
+    {
+        ErrorState = E_OS_ID;
+    }
+    else
+#endif /* (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED) */
+    if ((SCHEDULETABLE_RUNNING != ScheduleTables[ScheduleTableID].OsScheduleTableState) &&
+        (SCHEDULETABLE_RUNNING_AND_SYNCHRONOUS != ScheduleTables[ScheduleTableID].OsScheduleTableState))
+    {
+        ErrorState = E_OS_STATE;
+    }
+    else
+    {
+        ScheduleTables[ScheduleTableID].OsScheduleTableDeviation    = 0;
+        ScheduleTables[ScheduleTableID].OsScheduleTableSynchronised = FALSE;
+        ScheduleTables[ScheduleTableID].OsScheduleTableState        = SCHEDULETABLE_RUNNING;
+    }
+#else
+    (void)ScheduleTableID;
+
+    /* No schedule table configured */
+    ErrorState = E_OS_ID;
+#endif /* #if (SCHEDULE_TABLE_COUNT > 0) */
+
+    return ErrorState;
+}
+
+/***********************************************************************************/
+/*				    	 Internal Functions Definition		      				   */
+/***********************************************************************************/
+
+#if (SCHEDULE_TABLE_COUNT > 0)
+
+/**
+ * @brief Starts <Table> with its first round beginning at the counter value <Start>.
+ */
+static FUNC(void, OS_CODE) Os_ScheduleTableStart
+(
+    P2VAR(Os_ScheduleTable, AUTOMATIC, OS_VAR) Table,
+    CONST(TickType, AUTOMATIC) Start
+)
+{
+    P2VAR(Os_ScheduleTable *, AUTOMATIC, OS_VAR) Head = OS_SCHEDTBL_HEAD_OF(Table->OsScheduleTableCounterRef);
+
+    Table->OsScheduleTableState        = SCHEDULETABLE_RUNNING;
+    Table->OsScheduleTableCursor       = 0U;
+    Table->OsScheduleTableDeviation    = 0;
+    Table->OsScheduleTableSynchronised = FALSE;
+    Table->OsScheduleTableExpiryTime = (TickType)(((uint32)Start + Table->OsScheduleTableExpiryPoints[0].OsExpiryPointOffset) %
+                                                  ((uint32)Table->OsScheduleTableCounterRef->OsCounterMaxAllowedValue + 1UL));
+
+    Table->OsScheduleTableNext = *Head;
+    *Head = Table;
+}
+
+/**
+ * @brief Removes <Table> from the running tables of its counter.
+ */
+static FUNC(void, OS_CODE) Os_ScheduleTableStop
+(
+    P2VAR(Os_ScheduleTable, AUTOMATIC, OS_VAR) Table
+)
+{
+    P2VAR(Os_ScheduleTable *, AUTOMATIC, OS_VAR) Link = OS_SCHEDTBL_HEAD_OF(Table->OsScheduleTableCounterRef);
+
+    while ((NULL_PTR != *Link) && (Table != *Link))
+    {
+        Link = &(*Link)->OsScheduleTableNext;
+    }
+
+    if (NULL_PTR != *Link)
+    {
+        *Link = Table->OsScheduleTableNext;
+    }
+
+    Table->OsScheduleTableNext  = NULL_PTR;
+    Table->OsScheduleTableState = SCHEDULETABLE_STOPPED;
+}
+
+/**
+ * @brief Processes <Table> at its expiry time, and the points following at a distance of 0.
+ */
+static FUNC(void, OS_CODE) Os_ScheduleTableExpire
+(
+    P2VAR(Os_ScheduleTable, AUTOMATIC, OS_VAR) Table
+)
+{
+    P2VAR(Os_ScheduleTable, AUTOMATIC, OS_VAR) Current = Table;
+    P2VAR(Os_ScheduleTable, AUTOMATIC, OS_VAR) NextTable;
+    P2CONST(Os_ExpiryPoint, AUTOMATIC, OS_CONST) Points;
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter = Table->OsScheduleTableCounterRef;
+    VAR(uint8, AUTOMATIC) Cursor;
+    VAR(TickType, AUTOMATIC) Delay;
+
+    do
+    {
+        Points = Current->OsScheduleTableExpiryPoints;
+        Cursor = Current->OsScheduleTableCursor;
+
+        if (Cursor < Current->OsScheduleTableExpiryPointCount)
+        {
+            Os_ScheduleTableFireActions(&Points[Cursor]);
+
+            Cursor++;
+            Current->OsScheduleTableCursor = Cursor;
+
+            /* To the next point, or the final delay to the end of the round */
+            if (Cursor < Current->OsScheduleTableExpiryPointCount)
+            {
+                Delay = Points[Cursor].OsExpiryPointOffset - Points[Cursor - 1U].OsExpiryPointOffset;
+            }
+            else
+            {
+                Delay = Current->OsScheduleTableDuration - Points[Cursor - 1U].OsExpiryPointOffset;
+            }
+
+            if (0 != Current->OsScheduleTableDeviation)
+            {
+                Delay = Os_ScheduleTableAdjust(Current, &Points[Cursor - 1U], Delay);
+            }
+        }
+        else if (NULL_PTR != Current->OsScheduleTableNextTable)
+        {
+            /* End of the round: the chained table takes over at this tick */
+            NextTable = Current->OsScheduleTableNextTable;
+            Current->OsScheduleTableNextTable = NULL_PTR;
+            Os_ScheduleTableStop(Current);
+
+            Os_ScheduleTableStart(NextTable, Counter->OsCounterCurrentTicks);
+            Current = NextTable;
+            Delay = NextTable->OsScheduleTableExpiryPoints[0].OsExpiryPointOffset;
+        }
+        else if (TRUE == Current->OsScheduleTableRepeating)
+        {
+            /* End of the round: the next one starts at this tick */
+            Current->OsScheduleTableCursor = 0U;
+            Delay = Points[0].OsExpiryPointOffset;
+        }
+        else
+        {
+            /* End of a single-shot table */
+            Os_ScheduleTableStop(Current);
+            Delay = 1U;
+        }
+
+        Current->OsScheduleTableExpiryTime = (TickType)(((uint32)Counter->OsCounterCurrentTicks + Delay) %
+                                                        ((uint32)Counter->OsCounterMaxAllowedValue + 1UL));
+    } while (0U == Delay);
+}
+
+/**
+ * @brief Activates the tasks and then sets the events of the expiry point <Point>.
+ *
+ * The services only request the rescheduling, it is decided by the exit of the ISR or
+ * system call that advanced the counter.
+ */
+static FUNC(void, OS_CODE) Os_ScheduleTableFireActions
+(
+    P2CONST(Os_ExpiryPoint, AUTOMATIC, OS_CONST) Point
+)
+{
+    VAR(uint8, AUTOMATIC) Index;
+
+    for (Index = 0U; Index < Point->OsExpiryPointTaskCount; Index++)
+    {
+        (void)OS_ActivateTask(Point->OsExpiryPointTasks[Index]);
+    }
+
+    for (Index = 0U; Index < Point->OsExpiryPointEventCount; Index++)
+    {
+        (void)OS_SetEvent(Point->OsExpiryPointEvents[Index].OsScheduleTableEventTaskRef,
+                          Point->OsExpiryPointEvents[Index].OsScheduleTableEventMask);
+    }
+}
+
+/**
+ * @brief Corrects the deviation of <Table> on the delay following the expiry point <Point>,
+ * within the bounds of the point, and updates the synchronisation state.
+ *
+ * @return The delay to the next expiry point, at least 1 tick when it was shortened.
+ */
+static FUNC(TickType, OS_CODE) Os_ScheduleTableAdjust
+(
+    P2VAR(Os_ScheduleTable, AUTOMATIC, OS_VAR) Table,
+    P2CONST(Os_ExpiryPoint, AUTOMATIC, OS_CONST) Point,
+    CONST(TickType, AUTOMATIC) Delay
+)
+{
+    VAR(uint32, AUTOMATIC) Correction;
+    VAR(uint32, AUTOMATIC) Precision = (uint32)Table->OsScheduleTblExplicitPrecision;
+    VAR(TickType, AUTOMATIC) Adjusted = Delay;
+
+    if (Table->OsScheduleTableDeviation > 0)
+    {
+        /* Ahead of the synchronisation value: wait longer */
+        Correction = (uint32)Table->OsScheduleTableDeviation;
+        if (Correction > (uint32)Point->OsExpiryPointMaxLengthen)
+        {
+            Correction = (uint32)Point->OsExpiryPointMaxLengthen;
+        }
+
+        Adjusted += (TickType)Correction;
+        Table->OsScheduleTableDeviation -= (sint32)Correction;
+    }
+    else
+    {
+        /* Behind: wait less, the next point stays at least one tick away */
+        Correction = (uint32)(-Table->OsScheduleTableDeviation);
+        if (Correction > (uint32)Point->OsExpiryPointMaxShorten)
+        {
+            Correction = (uint32)Point->OsExpiryPointMaxShorten;
+        }
+        if (Correction >= (uint32)Delay)
+        {
+            Correction = (0U == Delay) ? 0U : ((uint32)Delay - 1UL);
+        }
+
+        Adjusted -= (TickType)Correction;
+        Table->OsScheduleTableDeviation += (sint32)Correction;
+    }
+
+    if (TRUE == Table->OsScheduleTableSynchronised)
+    {
+        if (((Table->OsScheduleTableDeviation >= 0) && ((uint32)Table->OsScheduleTableDeviation <= Precision)) ||
+            ((Table->OsScheduleTableDeviation < 0) && ((uint32)(-Table->OsScheduleTableDeviation) <= Precision)))
+        {
+            Table->OsScheduleTableState = SCHEDULETABLE_RUNNING_AND_SYNCHRONOUS;
+        }
+        else
+        {
+            Table->OsScheduleTableState = SCHEDULETABLE_RUNNING;
+        }
+    }
+
+    return Adjusted;
+}
+
+/**
+ * @brief Position of <Table> in its round at the current counter value, in
+ * [0, OsScheduleTableDuration). Before the first round, the position counts back from
+ * the end of a round.
+ */
+static FUNC(TickType, OS_CODE) Os_ScheduleTablePosition
+(
+    P2CONST(Os_ScheduleTable, AUTOMATIC, OS_VAR) Table
+)
+{
+    P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter = Table->OsScheduleTableCounterRef;
+
+    VAR(uint32, AUTOMATIC) Modulo = (uint32)Counter->OsCounterMaxAllowedValue + 1UL;
+    VAR(sint32, AUTOMATIC) Duration = (sint32)Table->OsScheduleTableDuration;
+    VAR(sint32, AUTOMATIC) NextOffset;
+    VAR(sint32, AUTOMATIC) Remaining;
+    VAR(sint32, AUTOMATIC) Position;
+
+    /* Offset of the next expiry point, the duration for the end of the round */
+    if (Table->OsScheduleTableCursor < Table->OsScheduleTableExpiryPointCount)
+    {
+        NextOffset = (sint32)Table->OsScheduleTableExpiryPoints[Table->OsScheduleTableCursor].OsExpiryPointOffset;
+    }
+    else
+    {
+        NextOffset = Duration;
+    }
+
+    Remaining = (sint32)((((uint32)Table->OsScheduleTableExpiryTime + Modulo) - (uint32)Counter->OsCounterCurrentTicks) % Modulo);
+
+    Position = (NextOffset - Remaining) % Duration;
+    if (Position < 0)
+    {
+        Position += Duration;
+    }
+
+    return (TickType)Position;
+}
+
+#endif /* #if (SCHEDULE_TABLE_COUNT > 0) */
+
+/***********************************************************************************/
+/*				    			 End Of File			         				   */
+/***********************************************************************************/
@@ -1,3 +1,6 @@
+/* Kernel main header file inclusion */
+#include <Os_kernel.h>
+
 /**
  * @brief The system service occupies the alarm <AlarmID> element.
  * When <start> ticks are reached, the task assigned to the alarm
@@ -21,6 +24,7 @@
  *             Standard:
  *                  • E_OK              No error
  *                  • E_OS_STATE        Alarm <AlarmID> is already in use
+ *                  • E_OS_LIMIT        Alarm heap of the counter full (OS_ALARM_QUEUE_HEAP)
  *             Extended:
  *                  • E_OS_ID           Alarm <AlarmID> is invalid
  *                  • E_OS_VALUE        Value of <start> outside of the admissible counter limit
@@ -47,9 +51,6 @@ OS_SetAbsAlarm(
     P2VAR(Os_Alarm, OS_CODE, TYPEDEF)
     Alarm = NULL_PTR;
 
-    VAR(uint8, TYPEDEF)
-    ActiveAlarmsHeadIndex;
-
 #if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
 
     if (AlarmID >= ALARM_COUNT)
@@ -73,8 +74,10 @@ OS_SetAbsAlarm(
 
     if (Alarm->OsAlarmState == ALARM_SLEEP)
     {
-        /* Get the counter head index */
-        ActiveAlarmsHeadIndex = Alarm->OsAlarmCounterRef->OsCounterAlarmsHeadIndex;
+#if (OS_COUNTER_TIMER_DRIVER == STD_ON)
+        /* <start> is placed relative to the current timer value */
+        OS_CounterTimerUpdate(Alarm->OsAlarmCounterRef);
+#endif /* #if (OS_COUNTER_TIMER_DRIVER == STD_ON) */
 
         Alarm->OsAlarmExpiryTime = start;
 
@@ -83,7 +86,19 @@ OS_SetAbsAlarm(
         Alarm->OsAlarmState = ALARM_ACTIVE;
 
         /* Update Alarm Expiry Queue */
-        OS_AlarmInsert(&ActiveAlarmsHead[ActiveAlarmsHeadIndex], Alarm);
+        OS_AlarmQueueInsert(Alarm);
+
+#if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_HEAP)
+        /* The heap of the counter is full (OS_ALARM_HEAP_SIZE) */
+        if (ALARM_SLEEP == Alarm->OsAlarmState)
+        {
+            ErrorState = E_OS_LIMIT;
+        }
+#endif /* #if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_HEAP) */
+
+#if (OS_COUNTER_TIMER_DRIVER == STD_ON)
+        OS_CounterTimerProgram(Alarm->OsAlarmCounterRef);
+#endif /* #if (OS_COUNTER_TIMER_DRIVER == STD_ON) */
     }
     else
     {
@@ -1,3 +1,6 @@
+/* Kernel main header file inclusion */
+#include <Os_kernel.h>
+
 /**
  * @brief The system service occupies the alarm <AlarmID> element.
  * After <increment> ticks have elapsed, the task assigned to the
@@ -22,6 +25,7 @@
  *             Standard:
  *                  • E_OK              No error
  *                  • E_OS_STATE        Alarm <AlarmID> is already in use
+ *                  • E_OS_LIMIT        Alarm heap of the counter full (OS_ALARM_QUEUE_HEAP)
  *             Extended:
  *                  • E_OS_ID           Alarm <AlarmID> is invalid
  *                  • E_OS_VALUE        Value of <increment> outside of the admissible limits
@@ -55,9 +59,6 @@ OS_SetRelAlarm(
     P2VAR(Os_Alarm, OS_CODE, TYPEDEF)
     Alarm = NULL_PTR;
 
-    VAR(uint8, TYPEDEF)
-    ActiveAlarmsHeadIndex;
-
 #if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
 
     if (AlarmID >= ALARM_COUNT)
@@ -81,8 +82,10 @@ OS_SetRelAlarm(
 
     if (Alarm->OsAlarmState == ALARM_SLEEP)
     {
-        /* Get the counter head index */
-        ActiveAlarmsHeadIndex = Alarm->OsAlarmCounterRef->OsCounterAlarmsHeadIndex;
+#if (OS_COUNTER_TIMER_DRIVER == STD_ON)
+        /* The increment counts from the current timer value */
+        OS_CounterTimerUpdate(Alarm->OsAlarmCounterRef);
+#endif /* #if (OS_COUNTER_TIMER_DRIVER == STD_ON) */
 
         /* Get current counter value */
         CurrentCounterTicks = Alarm->OsAlarmCounterRef->OsCounterCurrentTicks;
@@ -97,7 +100,19 @@ OS_SetRelAlarm(
         Alarm->OsAlarmState = ALARM_ACTIVE;
 
         /* Update Alarm Expiry Queue */
-        OS_AlarmInsert(&ActiveAlarmsHead[ActiveAlarmsHeadIndex], Alarm);
+        OS_AlarmQueueInsert(Alarm);
+
+#if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_HEAP)
+        /* The heap of the counter is full (OS_ALARM_HEAP_SIZE) */
+        if (ALARM_SLEEP == Alarm->OsAlarmState)
+        {
+            ErrorState = E_OS_LIMIT;
+        }
+#endif /* #if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_HEAP) */
+
+#if (OS_COUNTER_TIMER_DRIVER == STD_ON)
+        OS_CounterTimerProgram(Alarm->OsAlarmCounterRef);
+#endif /* #if (OS_COUNTER_TIMER_DRIVER == STD_ON) */
     }
     else
     {
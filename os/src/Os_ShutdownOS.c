@@ -0,0 +1,141 @@
+/**
+ * @file            Os_ShutdownOS.c
+ * @author          Mahmoud Ismail
+ * @version         1.0.0
+ * @date            19-10-2026
+ * @platform
+ * @variant
+ * @vendor          CryptOS
+ * @specification   OSEK/VDX
+ * @brief ShutdownOS() and RestartOS() API Implementation.
+ */
+
+/*------------------------- MISRA-C vailoations in c files -----------------------*/
+
+/**********************************************************************************/
+/**				    			Include Headers			         				 **/
+/**********************************************************************************/
+/* Kernel main header file inclusion */
+#include <Os_kernel.h>
+
+/***********************************************************************************/
+/*                        Internal Function Declration                             */
+/***********************************************************************************/
+/**
+ * @defgroup InternalFunctionsDeclration
+ * @{
+ */
+static FUNC(void, OS_CODE) Os_Shutdown
+(
+    CONST(StatusType, AUTOMATIC) Error
+);
+/** @} */ /*End of InternalFunctionsDeclration*/
+
+/***********************************************************************************/
+/*				    	 External Functions Definition		      				   */
+/***********************************************************************************/
+
+/**
+ * @brief The user can call this system service to abort the overall system
+ * (e.g. emergency off).
+ *
+ *
+ * @service name    ShutdownOS
+ * @syntax          FUNC(StatusType, OS_CODE) OS_ShutdownOS
+ *                  (
+ *                      CONST(StatusType, AUTOMATIC) Error
+ *                  );
+ * @service ID      -
+ * @sync/async      Synchronous
+ * @reentrancy      Reentrant
+ * @param[in]       Error     Error occurred
+ * @param[out]      -
+ * @return          -
+ * @note            This call does not return, the port halts the core (OS_SHUTDOWN_HALT).
+ * @warning         -
+ */
+FUNC(StatusType, OS_CODE)
+OS_ShutdownOS(
+    CONST(StatusType, AUTOMATIC) Error)
+{
+    Os_Shutdown(Error);
+
+    /*[SWS_Os_00425] If ShutdownHook() returns, the OS disables all interrupts and
+    enters an endless loop. */
+    OS_SHUTDOWN_HALT();
+
+    return E_OK;
+}
+
+/**
+ * @brief Shuts the operating system down and starts it again in <Mode> without a
+ * reset of the core (warm restart).
+ *
+ * The running task is abandoned, OS_StartOS() re-initialises the kernel data in a time
+ * bounded by the configuration (tasks, priority levels, counters and alarms) and the
+ * system call epilogue dispatches the first task of <Mode>.
+ *
+ * @service name    RestartOS
+ * @syntax          FUNC(StatusType, OS_CODE) OS_RestartOS
+ *                  (
+ *                      CONST(AppModeType, AUTOMATIC) Mode
+ *                  );
+ * @service ID      -
+ * @sync/async      Synchronous
+ * @reentrancy      Non Reentrant
+ * @param[in]       Mode      Application mode of the restart
+ * @param[out]      -
+ * @return          E_OS_ID        <Mode> is not a configured application mode.
+ *                  E_OS_CALLEVEL  Call at interrupt level.
+ * @note            The call does not return on success.
+ * @warning         -
+ */
+FUNC(StatusType, OS_CODE)
+OS_RestartOS(
+    CONST(AppModeType, AUTOMATIC) Mode)
+{
+    VAR(StatusType, AUTOMATIC) ReturnStatus = E_OK;
+
+    if (Mode >= MAX_NO_APPMODES)
+    {
+        ReturnStatus = E_OS_ID;
+    }
+    else if (0U != Kernel.IsrNestingLevel)
+    {
+        /* The exit of the interrupted ISRs would run on the new kernel state */
+        ReturnStatus = E_OS_CALLEVEL;
+    }
+    else
+    {
+        Os_Shutdown(E_OK);
+
+        /* Re-entrant start, the previous context is not saved (Kernel.TaskPreempted) */
+        OS_StartOS(Mode);
+    }
+
+    return ReturnStatus;
+}
+
+/***********************************************************************************/
+/*				    	 Internal Functions Definition		      				   */
+/***********************************************************************************/
+
+static FUNC(void, OS_CODE) Os_Shutdown
+(
+    CONST(StatusType, AUTOMATIC) Error
+)
+{
+    /*[SWS_Os_00071] ShutdownOS calls the ShutdownHook with <Error>. */
+#if (SHUTDOWN_HOOK == STD_ON)
+    Kernel.OsState = OS_STATE_SHUTDOWNHOOK;
+    ShutdownHook(Error);
+#else
+    (void)Error;
+#endif /* #if (SHUTDOWN_HOOK == STD_ON) */
+
+    Kernel.OsState = OS_STATE_SHUTDOWN;
+}
+
+/***********************************************************************************/
+/*				    			 End Of File			         				   */
+/***********************************************************************************/
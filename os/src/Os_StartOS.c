@@ -84,6 +84,19 @@
  * @{
  */
 /** @} */ /*End of ExternalFunctionsDeclration*/
+/***********************************************************************************/
+/*                        Internal Function Declration                             */
+/***********************************************************************************/
+/**
+ * @defgroup InternalFunctionsDeclration
+ * @{
+ */
+static FUNC(void, OS_CODE) Os_InitKernelData
+(
+    void
+);
+/** @} */ /*End of InternalFunctionsDeclration*/
+
 /***********************************************************************************/
 /*				    	 External Functions Definition		      				   */
 /***********************************************************************************/
@@ -104,7 +117,9 @@
  * @param[in]       Mode      Application mode
  * @param[out]      -
  * @return          -
- * @note            This call does not need to return.
+ * @note            This call does not need to return. It is re-entrant for the warm
+ *                  restart (OS_RestartOS): the kernel data is re-initialised first, so
+ *                  it does not rely on the state left by a cold reset.
  * @warning         -
  */
 
@@ -114,9 +129,12 @@ OS_StartOS(
 {
 
     /* Starting OS */
-    Kernel.OsState = OS_STATE_BOOT;
+    Os_InitKernelData();
 
-    ReadyQueueInit();
+#if (OS_MPU_PROTECTION == STD_ON)
+    /* Static MPU regions, the task regions are loaded on every context switch */
+    Os_MpuInit();
+#endif /* #if (OS_MPU_PROTECTION == STD_ON) */
 
     /* OsInitCode(), ReadyQueueInit(), Any OS Intilizatin code needed */
 
@@ -136,7 +154,7 @@ OS_StartOS(
             LocalAlarmIndex = ApplicationModes[Mode].AutoStartAlarms[LocalIndex];
             
             /* Absolute Alarm */
-            if (Alarms[LocalIndex].OsAlarmAutoStartType == ALARM_ABSOLUTE)
+            if (Alarms[LocalAlarmIndex].OsAlarmAutoStartType == ALARM_ABSOLUTE)
             {
                 OS_SetAbsAlarm(LocalAlarmIndex, Alarms[LocalAlarmIndex].OsAlarmAlarmTime, Alarms[LocalAlarmIndex].OsAlarmCycleTime);
             }
@@ -163,16 +181,102 @@ OS_StartOS(
     /*[SWS_OS_00100] The first call to StartOS (for starting the Operating System) shall not return. */
 }
 /***********************************************************************************/
-/*                        Internal Function Declration                             */
+/*				    	 Internal Functions Definition		      				   */
 /***********************************************************************************/
+
 /**
- * @defgroup InternalFunctionsDeclration
- * @{
+ * @brief Sets the run time data of the kernel to its generated initial values.
+ *
+ * One pass over the priority levels, tasks, counters and alarms: the time is bounded
+ * by the configuration and does not depend on the state left by the previous run.
  */
-/** @} */ /*End of InternalFunctionsDeclration*/
-/***********************************************************************************/
-/*				    	 Internal Functions Definition		      				   */
-/***********************************************************************************/
+static FUNC(void, OS_CODE) Os_InitKernelData
+(
+    void
+)
+{
+    VAR(uint8, AUTOMATIC) LocalIndex;
+    P2VAR(Os_TaskDynamic, AUTOMATIC, OS_VAR) TaskDynamic;
+
+    Kernel.TaskQueueHead    = NULL_PTR;
+    Kernel.TaskRunning      = NULL_PTR;
+    /* No context of the previous run is saved by the first dispatch */
+    Kernel.TaskPreempted    = NULL_PTR;
+    Kernel.OsState          = OS_STATE_BOOT;
+    Kernel.ForceScheduling  = FALSE;
+    Kernel.SchedulerNeeded  = FALSE;
+    Kernel.DispatcherNeeded = FALSE;
+    Kernel.NewContext       = FALSE;
+    Kernel.IsrNestingLevel  = 0U;
+    Kernel.IsrPreviousState = OS_STATE_BOOT;
+    Kernel.IdleWaiting      = FALSE;
+
+    (void)ReadyQueueInit();
+
+    for (LocalIndex = 0U; LocalIndex < TASK_COUNT; LocalIndex++)
+    {
+#if (RESOURCE_COUNT > 0)
+        OS_ReleaseAllResources(LocalIndex);
+#endif /* #if (RESOURCE_COUNT > 0) */
+
+        if (NULL_PTR != Tasks[LocalIndex].InternalResource)
+        {
+            Tasks[LocalIndex].InternalResource->InternalResourceDynamics->TakenFlag = FALSE;
+        }
+
+        TaskDynamic = Tasks[LocalIndex].TaskDynamics;
+
+        TaskDynamic->EventsSet                 = 0U;
+        TaskDynamic->EventsWaiting             = 0U;
+        TaskDynamic->TaskCurrentPriority       = Tasks[LocalIndex].TaskStaticPriority;
+        TaskDynamic->TaskState                 = SUSPENDED;
+        TaskDynamic->PendingActivationRequests = 0U;
+
+        /* The idle task has no ready queue, its generated index never changes */
+        if (IdleTaskId != LocalIndex)
+        {
+            TaskDynamic->PriorityQueueIndex = ReadyQueueGetQueueIndexByPriority(Tasks[LocalIndex].TaskStaticPriority);
+        }
+    }
+
+#if (SCHEDULE_TABLE_COUNT > 0)
+    /* Before the counters, their compare timer is programmed for the running tables */
+    OS_ScheduleTableInit();
+#endif /* #if (SCHEDULE_TABLE_COUNT > 0) */
+
+#if (COUNTER_COUNT > 0)
+    for (LocalIndex = 0U; LocalIndex < COUNTER_COUNT; LocalIndex++)
+    {
+        /* Counter value, extended value and time snapshot at 0 */
+        OS_CounterTimeInit(&Counters[LocalIndex]);
+        OS_AlarmQueueInit(&Counters[LocalIndex]);
+
+#if (OS_COUNTER_TIMER_DRIVER == STD_ON)
+        /* The counter starts at the current timer value */
+        OS_CounterTimerInit(&Counters[LocalIndex]);
+#endif /* #if (OS_COUNTER_TIMER_DRIVER == STD_ON) */
+
+        /* The other hardware counters start their own tick source */
+        OS_CounterDriverStart(&Counters[LocalIndex]);
+    }
+#endif /* #if (COUNTER_COUNT > 0) */
+
+#if (ALARM_COUNT > 0)
+    for (LocalIndex = 0U; LocalIndex < ALARM_COUNT; LocalIndex++)
+    {
+        Alarms[LocalIndex].OsAlarmState    = ALARM_SLEEP;
+#if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_HEAP)
+        Alarms[LocalIndex].OsAlarmHeapIndex = OS_ALARM_HEAP_NONE;
+#else
+        Alarms[LocalIndex].OsAlarmNext     = NULL_PTR;
+        Alarms[LocalIndex].OsAlarmPrevious = NULL_PTR;
+#endif /* #if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_HEAP) */
+#if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_WHEEL)
+        Alarms[LocalIndex].OsAlarmSlot     = NULL_PTR;
+#endif /* #if (OS_ALARM_QUEUE == OS_ALARM_QUEUE_WHEEL) */
+    }
+#endif /* #if (ALARM_COUNT > 0) */
+}
 
 /***********************************************************************************/
 /*				    			 End Of File			         				   */
@@ -0,0 +1,117 @@
+/**
+ * @file Os_Tickless.c
+ * @author Mahmoud Ismail
+ * @version 1.0.0
+ * @date 19-10-2026
+ * @platform
+ * @variant
+ * @vendor CryptOS
+ * @specification OSEK/VDX
+ * @brief Tickless idle of the system counter (Counters[0]).
+ *
+ * When the idle task is selected the tick source is reprogrammed by the port to fire
+ * on the tick of the next alarm expiry (Os_TicklessSleep). The first Category 2 ISR
+ * taken in idle, SysTick included, reads the number of whole ticks that passed
+ * (Os_TicklessWake) and adds them to the counter before its body runs.
+ *
+ * The sleep always ends at least one tick before the next expiry: the ticks added on
+ * wake-up never expire an alarm, the expiry tick itself is counted by SysTick_Handler.
+ */
+
+/**********************************************************************************/
+/**				    			Include Headers			         				 **/
+/**********************************************************************************/
+#include <Os_kernel.h>
+
+#if ((OS_TICKLESS_IDLE == STD_ON) && (COUNTER_COUNT > 0))
+
+/***************************************************************************************/
+/*                              Internal Global Variables                              */
+/***************************************************************************************/
+
+/* The tick source is reprogrammed for a sleep of the idle task */
+static VAR(boolean, OS_VAR) Os_TicklessSleeping = FALSE;
+
+/***********************************************************************************/
+/*                        Internal Function Declration                             */
+/***********************************************************************************/
+
+static FUNC(TickType, OS_CODE) Os_TicksToNextExpiry
+(
+	P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter
+);
+
+/***********************************************************************************/
+/*				    	 External Functions Definition		      				   */
+/***********************************************************************************/
+
+/* Called with the kernel locked, Kern_Schedule and the exit of the outermost ISR */
+FUNC(void, OS_CODE) OS_TicklessEnter
+(
+	void
+)
+{
+	VAR(TickType, AUTOMATIC) Ticks;
+
+	if (FALSE == Os_TicklessSleeping)
+	{
+		Ticks = Os_TicksToNextExpiry(&Counters[0]);
+
+		/* Nothing to gain when the next tick expires an alarm */
+		if (Ticks > 1U)
+		{
+			(void)Os_TicklessSleep((uint32)Ticks);
+			Os_TicklessSleeping = TRUE;
+		}
+	}
+}
+
+/* Called with the kernel locked at the entry of the outermost ISR */
+FUNC(void, OS_CODE) OS_TicklessLeave
+(
+	void
+)
+{
+	VAR(uint32, AUTOMATIC) Elapsed;
+	P2VAR(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter = &Counters[0];
+
+	if (TRUE == Os_TicklessSleeping)
+	{
+		Os_TicklessSleeping = FALSE;
+
+		/* Whole ticks before the one that may be pending in SysTick */
+		Elapsed = Os_TicklessWake();
+
+		/* Fewer ticks than to the next expiry, none of them expires an alarm */
+		OS_AdvanceHardwareCounter(Counter, (TickType)Elapsed);
+	}
+}
+
+/***********************************************************************************/
+/*				    	 Internal Functions Definition		      				   */
+/***********************************************************************************/
+
+/**
+ * @brief Ticks from now to the next alarm or schedule table expiry of <Counter>, a whole
+ * counter period if none is active.
+ */
+static FUNC(TickType, OS_CODE) Os_TicksToNextExpiry
+(
+	P2CONST(Os_Counter, AUTOMATIC, OS_APPL_DATA) Counter
+)
+{
+	VAR(TickType, AUTOMATIC) Ticks = OS_CounterNextExpiry(Counter);
+
+	if (0U == Ticks)
+	{
+		Ticks = (TickType)((uint32)Counter->OsCounterMaxAllowedValue + 1UL);
+	}
+
+	return Ticks;
+}
+
+#endif /* #if ((OS_TICKLESS_IDLE == STD_ON) && (COUNTER_COUNT > 0)) */
+
+/***********************************************************************************/
+/*				    			 End Of File			         				   */
+/***********************************************************************************/
@@ -18,6 +18,7 @@
 /**********************************************************************************/
 #include <Os_kernel.h>
 #include <Os_syscalls.h>
+#include <Os_kernel_intlock.h>
 
 
 
@@ -33,19 +34,25 @@
 /************************************************************************************/
 
 
+/***********************************************************************************/
+/*                        Internal Function Declration                             */
+/***********************************************************************************/
+
+static FUNC(StatusType, OS_CODE) OS_Dispatch
+(
+    void
+);
+
+
 
 
 
 /*************************************************************************************/
 /*                            External Global Variables                              */
 /*************************************************************************************/
-typedef void (*os_syscall_ptr)(void);
-extern const os_syscall_ptr OS_syscallTable[OS_N_SYSCALL];
-
-
 const os_syscall_ptr OS_syscallTable[OS_N_SYSCALL] = 
 {
-	(os_syscall_ptr) 0,
+	(os_syscall_ptr) &OS_Dispatch,
 	(os_syscall_ptr) &OS_StartOS,
 	(os_syscall_ptr) &OS_ActivateTask,
 	(os_syscall_ptr) &OS_TerminateTask		,
@@ -64,8 +71,19 @@ const os_syscall_ptr OS_syscallTable[OS_N_SYSCALL] =
 	(os_syscall_ptr) &OS_SetRelAlarm,
 	(os_syscall_ptr) &OS_SetAbsAlarm,
 	(os_syscall_ptr) &OS_CancelAlarm,
+	(os_syscall_ptr) &OS_SuspendInterrupts,
+	/* The resume services run inline, the task is privileged while it holds a lock */
 	(os_syscall_ptr) 0,
-	(os_syscall_ptr) 0
+	(os_syscall_ptr) &OS_ShutdownOS,
+	(os_syscall_ptr) &OS_RestartOS,
+	(os_syscall_ptr) &OS_StartScheduleTableRel,
+	(os_syscall_ptr) &OS_StartScheduleTableAbs,
+	(os_syscall_ptr) &OS_StopScheduleTable,
+	(os_syscall_ptr) &OS_NextScheduleTable,
+	(os_syscall_ptr) &OS_GetScheduleTableStatus,
+	(os_syscall_ptr) &OS_StartScheduleTableSynchron,
+	(os_syscall_ptr) &OS_SyncScheduleTable,
+	(os_syscall_ptr) &OS_SetScheduleTableAsync
 };
 
 
@@ -95,267 +113,30 @@ const os_syscall_ptr OS_syscallTable[OS_N_SYSCALL] =
 /***********************************************************************************/
 
 
+#if (OS_ARCH == OS_ARM)
+
+/* The other Cortex-M entry stubs are inlined from Os_syscalls_cm4.h, other ports provide their own entry */
+
 FUNC(void, OS_CODE) SVC_StartOS
 ( 
     CONST(AppModeType, AUTOMATIC) Mode
 )
 {
+		/* Kernel exceptions below the Category 2 ISRs, see OS_KERNEL_LOCK_LEVEL */
+		Os_InitKernelLock();
+
+		/* Generated vector table and ISR priorities */
+		Os_InitInterrupts();
+
 		__asm("PUSH {R0}");
 	  /*0x20002500-0x20016000*/
 		IFX_SET_PSP(0x20002500);
 		IFX_SWITCH_SP_TO_PSP();	
 		__asm("POP {R0}");
-		KERN_SC_STARTOS();
+		OS_SVC_TRAP(OS_SC_StartOs);
 }
 
-
-FUNC(StatusType, OS_CODE) SVC_ActivateTask
-( 
-    CONST(TaskType, AUTOMATIC) TaskID 
-)
-{
-		StatusType ReturnStatus;
-	
-		KERN_SC_ACTIVATETASK();
-
-		__asm volatile ("mov %0, R0" : "=r" (ReturnStatus));
-	
-		return ReturnStatus;
-}
-
-FUNC(StatusType, OS_CODE) SVC_TerminateTask
-( 
-    void 
-)
-{
-		StatusType ReturnStatus;
-	
-		KERN_SC_TERMINATETASK();
-	
-		__asm volatile ("mov %0, R0" : "=r" (ReturnStatus));
-	
-		return ReturnStatus;
-}
-
-FUNC(StatusType, OS_CODE) SVC_ChainTask
-(
-    CONST(TaskType, AUTOMATIC) TaskID
-)
-{
-    StatusType ReturnStatus;
-	
-		KERN_SC_CHAINTASK();
-	
-		__asm volatile ("mov %0, R0" : "=r" (ReturnStatus));
-	
-		return ReturnStatus;
-}
-
-FUNC(StatusType, OS_CODE) SVC_Schedule
-( 
-    void 
-)
-{
-		StatusType ReturnStatus;
-	
-		KERN_SC_SCHEDULE();
-	
-		__asm volatile ("mov %0, R0" : "=r" (ReturnStatus));
-	
-		return ReturnStatus;
-}
-
-FUNC(StatusType, OS_CODE) SVC_GetTaskID
-(
-    CONST(TaskRefType, AUTOMATIC) TaskID
-)
-{
-		StatusType ReturnStatus;
-	
-		KERN_SC_GETTASKID();
-	
-		__asm volatile ("mov %0, R0" : "=r" (ReturnStatus));
-	
-		return ReturnStatus;
-}
-
-FUNC(StatusType, OS_CODE) SVC_GetTaskState 
-( 
-    CONST(TaskType, AUTOMATIC) TaskID, 
-    CONST(TaskStateRefType, AUTOMATIC) State
-)
-{
-		StatusType ReturnStatus;
-	
-		KERN_SC_GETTASKSTATE();
-	
-		__asm volatile ("mov %0, R0" : "=r" (ReturnStatus));
-	
-		return ReturnStatus;
-}
-
-FUNC(StatusType,OS_CODE) SVC_GetResource
-(
-	CONST(ResourceType,AUTOMATIC)	ResID
-)
-{
-		StatusType ReturnStatus;
-	
-		KERN_SC_GETRESOURCE();
-	
-		__asm volatile ("mov %0, R0" : "=r" (ReturnStatus));
-	
-		return ReturnStatus;
-}
-
-FUNC(StatusType,OS_CODE) SVC_ReleaseResource
-(
-	CONST(ResourceType,AUTOMATIC)	ResID
-)
-{
-		StatusType ReturnStatus;
-	
-		KERN_SC_RELEASERESOURCE();
-	
-		__asm volatile ("mov %0, R0" : "=r" (ReturnStatus));
-	
-		return ReturnStatus;	
-}
-
-FUNC(StatusType, OS_CODE) SVC_SetEvent
-(
-    CONST(TaskType, AUTOMATIC) TaskID,
-    CONST(EventMaskType, AUTOMATIC) Mask
-)
-{
-		StatusType ReturnStatus;
-	
-		KERN_SC_SETEVENT();
-	
-		__asm volatile ("mov %0, R0" : "=r" (ReturnStatus));
-	
-		return ReturnStatus;	
-}
-
-FUNC(StatusType,OS_CODE) SVC_WaitEvent
-(
-    CONST(EventMaskType, AUTOMATIC) Mask
-)
-{
-		StatusType ReturnStatus;
-	
-		KERN_SC_WAITEVENT();
-	
-		__asm volatile ("mov %0, R0" : "=r" (ReturnStatus));
-	
-		return ReturnStatus;	
-}
-
-FUNC(StatusType, OS_CODE) SVC_GetEvent
-(
-	        CONST(TaskType, AUTOMATIC) TaskID,
-          EventMaskRefType Event
-)
-{
-		StatusType ReturnStatus;
-	
-		KERN_SC_GETEVENT();
-	
-		__asm volatile ("mov %0, R0" : "=r" (ReturnStatus));
-	
-		return ReturnStatus;	
-}
-
-FUNC(StatusType,OS_CODE) SVC_ClearEvent
-(
-    CONST(EventMaskType, AUTOMATIC) Mask
-)
-{
-		StatusType ReturnStatus;
-	
-		KERN_SC_CLEAREVENT();
-	
-		__asm volatile ("mov %0, R0" : "=r" (ReturnStatus));
-	
-		return ReturnStatus;	
-}
-
-FUNC(StatusType,OS_CODE) SVC_GetAlarmBase
-(
-    CONST(AlarmType, AUTOMATIC) AlarmID,
-    P2VAR(AlarmBaseType, AUTOMATIC, OS_APPL_DATA) Info
-)
-{
-		StatusType ReturnStatus;
-	
-	  KERN_SC_GETALARMBASE();
-	
-		__asm volatile ("mov %0, R0" : "=r" (ReturnStatus));
-	
-		return ReturnStatus;	
-	
-}
-FUNC(StatusType,OS_CODE) SVC_GetAlarm
-(
-    CONST(AlarmType, AUTOMATIC) AlarmID,
-    P2VAR(TickType, AUTOMATIC, OS_APPL_DATA) Tick
-)
-{
-	StatusType ReturnStatus;
-	
-	KERN_SC_GETALARM();
-	
-	__asm volatile ("mov %0, R0" : "=r" (ReturnStatus));
-	
-	return ReturnStatus;	
-}
-
-FUNC(StatusType,OS_CODE) SVC_SetRelAlarm
-(
-    CONST(AlarmType, AUTOMATIC) AlarmID,
-    CONST(TickType, AUTOMATIC) increment,
-    CONST(TickType, AUTOMATIC) cycle
-)
-{
-		StatusType ReturnStatus;
-	
-	  KERN_SC_SETRELALARM();
-	
-		__asm volatile ("mov %0, R0" : "=r" (ReturnStatus));
-	
-		return ReturnStatus;	
-}
-
-FUNC(StatusType,OS_CODE) SVC_SetAbsAlarm
-(
-    CONST(AlarmType, AUTOMATIC) AlarmID,
-    CONST(TickType, AUTOMATIC) start,
-    CONST(TickType, AUTOMATIC) cycle
-)
-{
-		StatusType ReturnStatus;
-	
-	KERN_SC_SETABSALARM();
-	
-		
-		__asm volatile ("mov %0, R0" : "=r" (ReturnStatus));
-	
-		return ReturnStatus;	
-}
-
-FUNC(StatusType,OS_CODE) SVC_CancelAlarm
-(
-   CONST(AlarmType, AUTOMATIC) AlarmID
-)
-{
-		StatusType ReturnStatus;
-	
-	KERN_SC_CANCELALARM();
-	
-			__asm volatile ("mov %0, R0" : "=r" (ReturnStatus));
-	
-		return ReturnStatus;	
-}
+#endif /* #if (OS_ARCH == OS_ARM) */
 	
 	
 	
@@ -373,6 +154,22 @@ FUNC(StatusType,OS_CODE) SVC_CancelAlarm
 /***********************************************************************************/
 
 
+/***********************************************************************************/
+/*				    	 Internal Functions Definition		      				   */
+/***********************************************************************************/
+
+/**
+ * @brief Service 0: does nothing, the system call handler then runs the scheduling
+ * and dispatching left pending by a trusted direct call (Kernel.SchedulerNeeded).
+ */
+static FUNC(StatusType, OS_CODE) OS_Dispatch
+(
+    void
+)
+{
+		return E_OK;
+}
+
 /***********************************************************************************/
 /*				    			 End Of File			         				   */
 /***********************************************************************************/
@@ -416,12 +416,20 @@ void GetHighestReadyTask
    
 #if (CONFORMANCE_CLASS == BCC2_CLASS || CONFORMANCE_CLASS == ECC2_CLASS)
 	
-    /* Read the task from the front of its priority queue for BCC2 and ECC2 classes */
-    result = QueuePeek(&(ReadyQueue.PriorityQueue[ReadyQueue.CurrentHighestPriorityIndex]),Task);
+    /* No priority level holds a ready task, do not index past the queues */
+    if (MAX_PRORITY_INDEX == ReadyQueue.CurrentHighestPriorityIndex)
+    {
+        result = E_FIFO_EMPTY;
+    }
+    else
+    {
+        /* Read the task from the front of its priority queue for BCC2 and ECC2 classes */
+        result = QueuePeek(&(ReadyQueue.PriorityQueue[ReadyQueue.CurrentHighestPriorityIndex]),Task);
+    }
 	
 		if(E_FIFO_EMPTY == result)
 		{
-			Kernel.TaskQueueHead = NULL_PTR;
+			*Task = NULL_PTR;
 		}
 	
 #endif /* #if (CONOFRMANCE_CLASS == BCC2_CLASS || CONOFRMANCE_CLASS == ECC2_CLASS) */